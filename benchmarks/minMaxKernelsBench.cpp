@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ascParser.hpp"
+#include "minMaxKernels.hpp"
+
+// Times MinMaxKernels::maskedMinMax row by row over whole grids, once per instruction set the CPU supports.
+// Usage: minMaxKernelsBench [file.asc ...] (defaults to the sample DEMs)
+
+struct RunResult
+{
+    double      milliseconds = 0.0;
+    float       min          = 0.0f;
+    float       max          = 0.0f;
+    std::size_t validCount   = 0;
+};
+
+template <typename T>
+static RunResult runKernel(const T* data, const AscParser::Header& header, int repetitions)
+{
+    const T   nodata = static_cast<T>(header.nodata_value);
+    RunResult result;
+    result.milliseconds = std::numeric_limits<double>::max();
+
+    for (int i = 0; i < repetitions; ++i)
+    {
+        float       min        = std::numeric_limits<float>::max();
+        float       max        = std::numeric_limits<float>::lowest();
+        std::size_t validCount = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int r = 0; r < header.nrows; ++r)
+        {
+            const T* row = data + static_cast<std::size_t>(r) * header.ncols;
+            validCount += MinMaxKernels::maskedMinMax(row, header.ncols, nodata, min, max);
+        }
+
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        result.milliseconds = std::min(result.milliseconds, elapsed.count());
+        result.min          = min;
+        result.max          = max;
+        result.validCount   = validCount;
+    }
+
+    return result;
+}
+
+static void benchmarkFile(const std::string& filepath, AscParser::Precision precision)
+{
+    const int repetitions = 20;
+
+    AscParser::LoadOptions options;
+    options.mode      = AscParser::LoadMode::Parallel;
+    options.precision = precision;
+
+    const AscParser ascData(filepath, options);
+    const auto&     header = ascData.getHeader();
+
+    std::printf("%s (%d x %d, %s)\n",
+                filepath.c_str(),
+                header.ncols,
+                header.nrows,
+                precision == AscParser::Precision::Float ? "float" : "double");
+
+    const MinMaxKernels::Isa isas[] = {MinMaxKernels::Isa::Scalar, MinMaxKernels::Isa::Sse2, MinMaxKernels::Isa::Avx2};
+    const MinMaxKernels::Isa active = MinMaxKernels::getIsa();
+
+    RunResult scalar;
+
+    for (const MinMaxKernels::Isa isa : isas)
+    {
+        if (!MinMaxKernels::isIsaSupported(isa))
+        {
+            continue;
+        }
+
+        MinMaxKernels::setIsa(isa);
+
+        const RunResult result = (precision == AscParser::Precision::Float)
+                                     ? runKernel(ascData.getFloatData(), header, repetitions)
+                                     : runKernel(ascData.getDoubleData(), header, repetitions);
+
+        if (isa == MinMaxKernels::Isa::Scalar)
+        {
+            scalar = result;
+        }
+
+        const bool matches = result.min == scalar.min && result.max == scalar.max &&
+                             result.validCount == scalar.validCount;
+
+        std::printf("  %-6s %8.3f ms  %5.2fx  min %.3f max %.3f valid %zu%s\n",
+                    MinMaxKernels::getIsaName(isa),
+                    result.milliseconds,
+                    scalar.milliseconds / result.milliseconds,
+                    result.min,
+                    result.max,
+                    result.validCount,
+                    matches ? "" : "  MISMATCH");
+    }
+
+    MinMaxKernels::setIsa(active);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        files.push_back(argv[i]);
+    }
+
+    if (files.empty())
+    {
+        const std::string dataFolderPath = ASC_DATA_PATH;
+        files = {dataFolderPath + "/aletsch_32T.asc", dataFolderPath + "/gausshills_1.asc"};
+    }
+
+    try
+    {
+        for (const auto& file : files)
+        {
+            benchmarkFile(file, AscParser::Precision::Float);
+            benchmarkFile(file, AscParser::Precision::Double);
+        }
+    } catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "Benchmark error: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
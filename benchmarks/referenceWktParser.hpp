@@ -0,0 +1,59 @@
+#ifndef REFERENCE_WKT_PARSER_HPP
+#define REFERENCE_WKT_PARSER_HPP
+
+#include <string>
+#include <vector>
+
+#include "geoCsvParser.hpp"
+
+// The WKT parser as it was before it parsed in place, kept only as the baseline of wktParserBench.
+// Every value goes through a std::string copy and std::stod, and the geometry is built from nested vectors
+class ReferenceWktParser
+{
+public:
+    struct Point
+    {
+        double x = 0.0;
+        double y = 0.0;
+    };
+
+    struct LineString
+    {
+        std::vector<Point> points;
+    };
+
+    struct Polygon
+    {
+        std::vector<LineString> rings;
+    };
+
+    struct Geometry
+    {
+        GeoCsvParser::GeometryType type = GeoCsvParser::GeometryType::Unknown;
+        Point                      point;
+        std::vector<LineString>    lines;
+        std::vector<Polygon>       polygons;
+    };
+
+    ReferenceWktParser(std::string src);
+    Geometry parse();
+
+private:
+    std::string wktString;
+    size_t      pos = 0;
+
+    void        skipWhiteSpace();
+    std::string readWord();
+    void        skipOptionalDimensionToken();
+    bool        consume(char c);
+    void        expect(char c);
+    double      readNumber();
+
+    Point                      readPoint();
+    std::vector<Point>         readPointList();
+    LineString                 readLineString();
+    Polygon                    readPolygon();
+    GeoCsvParser::GeometryType baseGeomType(const std::string& lowerType);
+};
+
+#endif
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "geoCsvParser.hpp"
+#include "referenceWktParser.hpp"
+#include "wktParser.hpp"
+
+// Times WktParser over the geometry column of GeoCSV files against the previous string based parser, then the whole
+// GeoCsvParser load for reference.
+// Usage: wktParserBench [file.csv ...] (defaults to every .csv in data/geo)
+
+// Fields of a ';' separated record with the quotes removed. Good enough for the sample files, the parser under test
+// has its own tokenizer
+static std::vector<std::string> splitRecord(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+    bool                     inQuotes = false;
+
+    for (std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+
+        if (c == '"' && inQuotes && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            fields.back().push_back('"');
+            ++i;
+        }
+        else if (c == '"')
+        {
+            inQuotes = !inQuotes;
+        }
+        else if (c == ';' && !inQuotes)
+        {
+            fields.emplace_back();
+        }
+        else if (c != '\r')
+        {
+            fields.back().push_back(c);
+        }
+    }
+
+    return fields;
+}
+
+static std::vector<std::string> readGeometries(const std::string& filepath)
+{
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open())
+    {
+        throw std::runtime_error("Could not open file: " + filepath);
+    }
+
+    std::string line;
+    std::getline(in, line);
+
+    const std::vector<std::string> header = splitRecord(line);
+    const auto                     column = std::find(header.begin(), header.end(), "geom") - header.begin();
+
+    std::vector<std::string> geometries;
+    while (std::getline(in, line))
+    {
+        const std::vector<std::string> fields = splitRecord(line);
+
+        if (static_cast<std::size_t>(column) < fields.size())
+        {
+            geometries.push_back(fields[column]);
+        }
+    }
+
+    return geometries;
+}
+
+template <typename Body>
+static double bestOf(int repetitions, const Body& body)
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (int i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+static void benchmarkFile(const std::string& filepath)
+{
+    const int                      repetitions = 10;
+    const std::vector<std::string> geometries  = readGeometries(filepath);
+
+    std::size_t wktBytes = 0;
+    for (const auto& wkt : geometries)
+    {
+        wktBytes += wkt.size();
+    }
+
+    std::size_t                 pointCount = 0;
+    GeoCsvParser::GeometryStore store;
+
+    const auto parseAll = [&]()
+    {
+        store      = GeoCsvParser::GeometryStore();
+        pointCount = 0;
+
+        for (const auto& wkt : geometries)
+        {
+            const GeoCsvParser::Geometry geometry = WktParser(wkt).parse(store);
+            pointCount += (geometry.type == GeoCsvParser::GeometryType::Point) ? 1 : 0;
+        }
+
+        pointCount += store.points.size();
+    };
+
+    const double wktMs = bestOf(repetitions, parseAll);
+
+    std::size_t referencePointCount = 0;
+
+    const auto parseAllReference = [&]()
+    {
+        referencePointCount = 0;
+
+        for (const auto& wkt : geometries)
+        {
+            const ReferenceWktParser::Geometry geometry = ReferenceWktParser(wkt).parse();
+            referencePointCount += (geometry.type == GeoCsvParser::GeometryType::Point) ? 1 : 0;
+
+            for (const auto& line : geometry.lines)
+            {
+                referencePointCount += line.points.size();
+            }
+
+            for (const auto& polygon : geometry.polygons)
+            {
+                for (const auto& ring : polygon.rings)
+                {
+                    referencePointCount += ring.points.size();
+                }
+            }
+        }
+    };
+
+    const double referenceMs = bestOf(repetitions, parseAllReference);
+
+    GeoCsvParser::LoadOptions sequential;
+    GeoCsvParser::LoadOptions parallel;
+    parallel.mode = GeoCsvParser::LoadMode::Parallel;
+
+    const double sequentialMs = bestOf(repetitions, [&]() { GeoCsvParser parser(filepath, sequential); });
+    const double parallelMs   = bestOf(repetitions, [&]() { GeoCsvParser parser(filepath, parallel); });
+
+    std::printf("%s\n", filepath.c_str());
+    std::printf("  wkt ref  %8.3f ms  %7.1f MB/s  %zu points\n",
+                referenceMs,
+                static_cast<double>(wktBytes) / 1e3 / referenceMs,
+                referencePointCount);
+    std::printf("  wkt      %8.3f ms  %7.1f MB/s  %zu geometries, %zu points  %5.2fx%s\n",
+                wktMs,
+                static_cast<double>(wktBytes) / 1e3 / wktMs,
+                geometries.size(),
+                pointCount,
+                referenceMs / wktMs,
+                pointCount == referencePointCount ? "" : "  MISMATCH");
+    std::printf("  load seq %8.3f ms\n", sequentialMs);
+    std::printf("  load par %8.3f ms\n", parallelMs);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        files.push_back(argv[i]);
+    }
+
+    if (files.empty())
+    {
+        for (const auto& entry : std::filesystem::directory_iterator(GEO_DATA_PATH))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".csv")
+            {
+                files.push_back(entry.path().string());
+            }
+        }
+
+        std::sort(files.begin(), files.end());
+    }
+
+    try
+    {
+        for (const auto& file : files)
+        {
+            benchmarkFile(file);
+        }
+    } catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "Benchmark error: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,17 @@
+#version 120
+
+// Geo overlay. Line quads carry their position in the segment frame in radius units (x along the segment, negative
+// before its start, y across it), see GeoData::rebuildOverlay. Markers have zero texture coordinates and stay solid
+void main()
+{
+    vec2 p = gl_TexCoord[0].xy;
+
+    // Round cap before the start of the segment, straight band along it
+    float distance = (p.x < 0.0) ? length(p) : abs(p.y);
+
+    // One pixel wide antialiased edge centered on the radius
+    float pixel    = max(fwidth(distance), 1e-6);
+    float coverage = clamp((1.0 - distance) / pixel + 0.5, 0.0, 1.0);
+
+    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * coverage);
+}
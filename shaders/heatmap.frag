@@ -3,1887 +3,9 @@
 uniform sampler2D uFloatTexture;
 uniform float uClampMin;
 uniform float uClampMax;
-uniform int uColormapID;
-
-const int JET_STOPS = 5;
-const int TURBO_STOPS = 256;
-const int VIRIDIS_STOPS = 256;
-const int PLASMA_STOPS = 256;
-const int INFERNO_STOPS = 256;
-const int MAGMA_STOPS = 256;
-const int GIST_EARTH_STOPS = 256;
-const int TERRAIN_STOPS = 256;
-
-const vec3 JET_COLORS[JET_STOPS] = vec3[](
-    vec3(0.0, 0.0, 1.0), // Blue
-    vec3(0.0, 1.0, 1.0), // Cyan
-    vec3(0.0, 1.0, 0.0), // Green
-    vec3(1.0, 1.0, 0.0), // Yellow
-    vec3(1.0, 0.0, 0.0)  // Red
-);
-
-const vec3 TURBO_COLORS[TURBO_STOPS] = vec3[](
-    vec3(0.18995, 0.07176, 0.23217),
-    vec3(0.19483, 0.08339, 0.26149),
-    vec3(0.19956, 0.09498, 0.29024),
-    vec3(0.20415, 0.10652, 0.31844),
-    vec3(0.20860, 0.11802, 0.34607),
-    vec3(0.21291, 0.12947, 0.37314),
-    vec3(0.21708, 0.14087, 0.39964),
-    vec3(0.22111, 0.15223, 0.42558),
-    vec3(0.22500, 0.16354, 0.45096),
-    vec3(0.22875, 0.17481, 0.47578),
-    vec3(0.23236, 0.18603, 0.50004),
-    vec3(0.23582, 0.19720, 0.52373),
-    vec3(0.23915, 0.20833, 0.54686),
-    vec3(0.24234, 0.21941, 0.56942),
-    vec3(0.24539, 0.23044, 0.59142),
-    vec3(0.24830, 0.24143, 0.61286),
-    vec3(0.25107, 0.25237, 0.63374),
-    vec3(0.25369, 0.26327, 0.65406),
-    vec3(0.25618, 0.27412, 0.67381),
-    vec3(0.25853, 0.28492, 0.69300),
-    vec3(0.26074, 0.29568, 0.71162),
-    vec3(0.26280, 0.30639, 0.72968),
-    vec3(0.26473, 0.31706, 0.74718),
-    vec3(0.26652, 0.32768, 0.76412),
-    vec3(0.26816, 0.33825, 0.78050),
-    vec3(0.26967, 0.34878, 0.79631),
-    vec3(0.27103, 0.35926, 0.81156),
-    vec3(0.27226, 0.36970, 0.82624),
-    vec3(0.27334, 0.38008, 0.84037),
-    vec3(0.27429, 0.39043, 0.85393),
-    vec3(0.27509, 0.40072, 0.86692),
-    vec3(0.27576, 0.41097, 0.87936),
-    vec3(0.27628, 0.42118, 0.89123),
-    vec3(0.27667, 0.43134, 0.90254),
-    vec3(0.27691, 0.44145, 0.91328),
-    vec3(0.27701, 0.45152, 0.92347),
-    vec3(0.27698, 0.46153, 0.93309),
-    vec3(0.27680, 0.47151, 0.94214),
-    vec3(0.27648, 0.48144, 0.95064),
-    vec3(0.27603, 0.49132, 0.95857),
-    vec3(0.27543, 0.50115, 0.96594),
-    vec3(0.27469, 0.51094, 0.97275),
-    vec3(0.27381, 0.52069, 0.97899),
-    vec3(0.27273, 0.53040, 0.98461),
-    vec3(0.27106, 0.54015, 0.98930),
-    vec3(0.26878, 0.54995, 0.99303),
-    vec3(0.26592, 0.55979, 0.99583),
-    vec3(0.26252, 0.56967, 0.99773),
-    vec3(0.25862, 0.57958, 0.99876),
-    vec3(0.25425, 0.58950, 0.99896),
-    vec3(0.24946, 0.59943, 0.99835),
-    vec3(0.24427, 0.60937, 0.99697),
-    vec3(0.23874, 0.61931, 0.99485),
-    vec3(0.23288, 0.62923, 0.99202),
-    vec3(0.22676, 0.63913, 0.98851),
-    vec3(0.22039, 0.64901, 0.98436),
-    vec3(0.21382, 0.65886, 0.97959),
-    vec3(0.20708, 0.66866, 0.97423),
-    vec3(0.20021, 0.67842, 0.96833),
-    vec3(0.19326, 0.68812, 0.96190),
-    vec3(0.18625, 0.69775, 0.95498),
-    vec3(0.17923, 0.70732, 0.94761),
-    vec3(0.17223, 0.71680, 0.93981),
-    vec3(0.16529, 0.72620, 0.93161),
-    vec3(0.15844, 0.73551, 0.92305),
-    vec3(0.15173, 0.74472, 0.91416),
-    vec3(0.14519, 0.75381, 0.90496),
-    vec3(0.13886, 0.76279, 0.89550),
-    vec3(0.13278, 0.77165, 0.88580),
-    vec3(0.12698, 0.78037, 0.87590),
-    vec3(0.12151, 0.78896, 0.86581),
-    vec3(0.11639, 0.79740, 0.85559),
-    vec3(0.11167, 0.80569, 0.84525),
-    vec3(0.10738, 0.81381, 0.83484),
-    vec3(0.10357, 0.82177, 0.82437),
-    vec3(0.10026, 0.82955, 0.81389),
-    vec3(0.09750, 0.83714, 0.80342),
-    vec3(0.09532, 0.84455, 0.79299),
-    vec3(0.09377, 0.85175, 0.78264),
-    vec3(0.09287, 0.85875, 0.77240),
-    vec3(0.09267, 0.86554, 0.76230),
-    vec3(0.09320, 0.87211, 0.75237),
-    vec3(0.09451, 0.87844, 0.74265),
-    vec3(0.09662, 0.88454, 0.73316),
-    vec3(0.09958, 0.89040, 0.72393),
-    vec3(0.10342, 0.89600, 0.71500),
-    vec3(0.10815, 0.90142, 0.70599),
-    vec3(0.11374, 0.90673, 0.69651),
-    vec3(0.12014, 0.91193, 0.68660),
-    vec3(0.12733, 0.91701, 0.67627),
-    vec3(0.13526, 0.92197, 0.66556),
-    vec3(0.14391, 0.92680, 0.65448),
-    vec3(0.15323, 0.93151, 0.64308),
-    vec3(0.16319, 0.93609, 0.63137),
-    vec3(0.17377, 0.94053, 0.61938),
-    vec3(0.18491, 0.94484, 0.60713),
-    vec3(0.19659, 0.94901, 0.59466),
-    vec3(0.20877, 0.95304, 0.58199),
-    vec3(0.22142, 0.95692, 0.56914),
-    vec3(0.23449, 0.96065, 0.55614),
-    vec3(0.24797, 0.96423, 0.54303),
-    vec3(0.26180, 0.96765, 0.52981),
-    vec3(0.27597, 0.97092, 0.51653),
-    vec3(0.29042, 0.97403, 0.50321),
-    vec3(0.30513, 0.97697, 0.48987),
-    vec3(0.32006, 0.97974, 0.47654),
-    vec3(0.33517, 0.98234, 0.46325),
-    vec3(0.35043, 0.98477, 0.45002),
-    vec3(0.36581, 0.98702, 0.43688),
-    vec3(0.38127, 0.98909, 0.42386),
-    vec3(0.39678, 0.99098, 0.41098),
-    vec3(0.41229, 0.99268, 0.39826),
-    vec3(0.42778, 0.99419, 0.38575),
-    vec3(0.44321, 0.99551, 0.37345),
-    vec3(0.45854, 0.99663, 0.36140),
-    vec3(0.47375, 0.99755, 0.34963),
-    vec3(0.48879, 0.99828, 0.33816),
-    vec3(0.50362, 0.99879, 0.32701),
-    vec3(0.51822, 0.99910, 0.31622),
-    vec3(0.53255, 0.99919, 0.30581),
-    vec3(0.54658, 0.99907, 0.29581),
-    vec3(0.56026, 0.99873, 0.28623),
-    vec3(0.57357, 0.99817, 0.27712),
-    vec3(0.58646, 0.99739, 0.26849),
-    vec3(0.59891, 0.99638, 0.26038),
-    vec3(0.61088, 0.99514, 0.25280),
-    vec3(0.62233, 0.99366, 0.24579),
-    vec3(0.63323, 0.99195, 0.23937),
-    vec3(0.64362, 0.98999, 0.23356),
-    vec3(0.65394, 0.98775, 0.22835),
-    vec3(0.66428, 0.98524, 0.22370),
-    vec3(0.67462, 0.98246, 0.21960),
-    vec3(0.68494, 0.97941, 0.21602),
-    vec3(0.69525, 0.97610, 0.21294),
-    vec3(0.70553, 0.97255, 0.21032),
-    vec3(0.71577, 0.96875, 0.20815),
-    vec3(0.72596, 0.96470, 0.20640),
-    vec3(0.73610, 0.96043, 0.20504),
-    vec3(0.74617, 0.95593, 0.20406),
-    vec3(0.75617, 0.95121, 0.20343),
-    vec3(0.76608, 0.94627, 0.20311),
-    vec3(0.77591, 0.94113, 0.20310),
-    vec3(0.78563, 0.93579, 0.20336),
-    vec3(0.79524, 0.93025, 0.20386),
-    vec3(0.80473, 0.92452, 0.20459),
-    vec3(0.81410, 0.91861, 0.20552),
-    vec3(0.82333, 0.91253, 0.20663),
-    vec3(0.83241, 0.90627, 0.20788),
-    vec3(0.84133, 0.89986, 0.20926),
-    vec3(0.85010, 0.89328, 0.21074),
-    vec3(0.85868, 0.88655, 0.21230),
-    vec3(0.86709, 0.87968, 0.21391),
-    vec3(0.87530, 0.87267, 0.21555),
-    vec3(0.88331, 0.86553, 0.21719),
-    vec3(0.89112, 0.85826, 0.21880),
-    vec3(0.89870, 0.85087, 0.22038),
-    vec3(0.90605, 0.84337, 0.22188),
-    vec3(0.91317, 0.83576, 0.22328),
-    vec3(0.92004, 0.82806, 0.22456),
-    vec3(0.92666, 0.82025, 0.22570),
-    vec3(0.93301, 0.81236, 0.22667),
-    vec3(0.93909, 0.80439, 0.22744),
-    vec3(0.94489, 0.79634, 0.22800),
-    vec3(0.95039, 0.78823, 0.22831),
-    vec3(0.95560, 0.78005, 0.22836),
-    vec3(0.96049, 0.77181, 0.22811),
-    vec3(0.96507, 0.76352, 0.22754),
-    vec3(0.96931, 0.75519, 0.22663),
-    vec3(0.97323, 0.74682, 0.22536),
-    vec3(0.97679, 0.73842, 0.22369),
-    vec3(0.98000, 0.73000, 0.22161),
-    vec3(0.98289, 0.72140, 0.21918),
-    vec3(0.98549, 0.71250, 0.21650),
-    vec3(0.98781, 0.70330, 0.21358),
-    vec3(0.98986, 0.69382, 0.21043),
-    vec3(0.99163, 0.68408, 0.20706),
-    vec3(0.99314, 0.67408, 0.20348),
-    vec3(0.99438, 0.66386, 0.19971),
-    vec3(0.99535, 0.65341, 0.19577),
-    vec3(0.99607, 0.64277, 0.19165),
-    vec3(0.99654, 0.63193, 0.18738),
-    vec3(0.99675, 0.62093, 0.18297),
-    vec3(0.99672, 0.60977, 0.17842),
-    vec3(0.99644, 0.59846, 0.17376),
-    vec3(0.99593, 0.58703, 0.16899),
-    vec3(0.99517, 0.57549, 0.16412),
-    vec3(0.99419, 0.56386, 0.15918),
-    vec3(0.99297, 0.55214, 0.15417),
-    vec3(0.99153, 0.54036, 0.14910),
-    vec3(0.98987, 0.52854, 0.14398),
-    vec3(0.98799, 0.51667, 0.13883),
-    vec3(0.98590, 0.50479, 0.13367),
-    vec3(0.98360, 0.49291, 0.12849),
-    vec3(0.98108, 0.48104, 0.12332),
-    vec3(0.97837, 0.46920, 0.11817),
-    vec3(0.97545, 0.45740, 0.11305),
-    vec3(0.97234, 0.44565, 0.10797),
-    vec3(0.96904, 0.43399, 0.10294),
-    vec3(0.96555, 0.42241, 0.09798),
-    vec3(0.96187, 0.41093, 0.09310),
-    vec3(0.95801, 0.39958, 0.08831),
-    vec3(0.95398, 0.38836, 0.08362),
-    vec3(0.94977, 0.37729, 0.07905),
-    vec3(0.94538, 0.36638, 0.07461),
-    vec3(0.94084, 0.35566, 0.07031),
-    vec3(0.93612, 0.34513, 0.06616),
-    vec3(0.93125, 0.33482, 0.06218),
-    vec3(0.92623, 0.32473, 0.05837),
-    vec3(0.92105, 0.31489, 0.05475),
-    vec3(0.91572, 0.30530, 0.05134),
-    vec3(0.91024, 0.29599, 0.04814),
-    vec3(0.90463, 0.28696, 0.04516),
-    vec3(0.89888, 0.27824, 0.04243),
-    vec3(0.89298, 0.26981, 0.03993),
-    vec3(0.88691, 0.26152, 0.03753),
-    vec3(0.88066, 0.25334, 0.03521),
-    vec3(0.87422, 0.24526, 0.03297),
-    vec3(0.86760, 0.23730, 0.03082),
-    vec3(0.86079, 0.22945, 0.02875),
-    vec3(0.85380, 0.22170, 0.02677),
-    vec3(0.84662, 0.21407, 0.02487),
-    vec3(0.83926, 0.20654, 0.02305),
-    vec3(0.83172, 0.19912, 0.02131),
-    vec3(0.82399, 0.19182, 0.01966),
-    vec3(0.81608, 0.18462, 0.01809),
-    vec3(0.80799, 0.17753, 0.01660),
-    vec3(0.79971, 0.17055, 0.01520),
-    vec3(0.79125, 0.16368, 0.01387),
-    vec3(0.78260, 0.15693, 0.01264),
-    vec3(0.77377, 0.15028, 0.01148),
-    vec3(0.76476, 0.14374, 0.01041),
-    vec3(0.75556, 0.13731, 0.00942),
-    vec3(0.74617, 0.13098, 0.00851),
-    vec3(0.73661, 0.12477, 0.00769),
-    vec3(0.72686, 0.11867, 0.00695),
-    vec3(0.71692, 0.11268, 0.00629),
-    vec3(0.70680, 0.10680, 0.00571),
-    vec3(0.69650, 0.10102, 0.00522),
-    vec3(0.68602, 0.09536, 0.00481),
-    vec3(0.67535, 0.08980, 0.00449),
-    vec3(0.66449, 0.08436, 0.00424),
-    vec3(0.65345, 0.07902, 0.00408),
-    vec3(0.64223, 0.07380, 0.00401),
-    vec3(0.63082, 0.06868, 0.00401),
-    vec3(0.61923, 0.06367, 0.00410),
-    vec3(0.60746, 0.05878, 0.00427),
-    vec3(0.59550, 0.05399, 0.00453),
-    vec3(0.58336, 0.04931, 0.00486),
-    vec3(0.57103, 0.04474, 0.00529),
-    vec3(0.55852, 0.04028, 0.00579),
-    vec3(0.54583, 0.03593, 0.00638),
-    vec3(0.53295, 0.03169, 0.00705),
-    vec3(0.51989, 0.02756, 0.00780),
-    vec3(0.50664, 0.02354, 0.00863),
-    vec3(0.49321, 0.01963, 0.00955),
-    vec3(0.47960, 0.01583, 0.01055)
-);
-
-const vec3 VIRIDIS_COLORS[VIRIDIS_STOPS] = vec3[](
-    vec3(0.267004, 0.004874, 0.329415),
-    vec3(0.268510, 0.009605, 0.335427),
-    vec3(0.269944, 0.014625, 0.341379),
-    vec3(0.271305, 0.019942, 0.347269),
-    vec3(0.272594, 0.025563, 0.353093),
-    vec3(0.273809, 0.031497, 0.358853),
-    vec3(0.274952, 0.037752, 0.364543),
-    vec3(0.276022, 0.044167, 0.370164),
-    vec3(0.277018, 0.050344, 0.375715),
-    vec3(0.277941, 0.056324, 0.381191),
-    vec3(0.278791, 0.062145, 0.386592),
-    vec3(0.279566, 0.067836, 0.391917),
-    vec3(0.280267, 0.073417, 0.397163),
-    vec3(0.280894, 0.078907, 0.402329),
-    vec3(0.281446, 0.084320, 0.407414),
-    vec3(0.281924, 0.089666, 0.412415),
-    vec3(0.282327, 0.094955, 0.417331),
-    vec3(0.282656, 0.100196, 0.422160),
-    vec3(0.282910, 0.105393, 0.426902),
-    vec3(0.283091, 0.110553, 0.431554),
-    vec3(0.283197, 0.115680, 0.436115),
-    vec3(0.283229, 0.120777, 0.440584),
-    vec3(0.283187, 0.125848, 0.444960),
-    vec3(0.283072, 0.130895, 0.449241),
-    vec3(0.282884, 0.135920, 0.453427),
-    vec3(0.282623, 0.140926, 0.457517),
-    vec3(0.282290, 0.145912, 0.461510),
-    vec3(0.281887, 0.150881, 0.465405),
-    vec3(0.281412, 0.155834, 0.469201),
-    vec3(0.280868, 0.160771, 0.472899),
-    vec3(0.280255, 0.165693, 0.476498),
-    vec3(0.279574, 0.170599, 0.479997),
-    vec3(0.278826, 0.175490, 0.483397),
-    vec3(0.278012, 0.180367, 0.486697),
-    vec3(0.277134, 0.185228, 0.489898),
-    vec3(0.276194, 0.190074, 0.493001),
-    vec3(0.275191, 0.194905, 0.496005),
-    vec3(0.274128, 0.199721, 0.498911),
-    vec3(0.273006, 0.204520, 0.501721),
-    vec3(0.271828, 0.209303, 0.504434),
-    vec3(0.270595, 0.214069, 0.507052),
-    vec3(0.269308, 0.218818, 0.509577),
-    vec3(0.267968, 0.223549, 0.512008),
-    vec3(0.266580, 0.228262, 0.514349),
-    vec3(0.265145, 0.232956, 0.516599),
-    vec3(0.263663, 0.237631, 0.518762),
-    vec3(0.262138, 0.242286, 0.520837),
-    vec3(0.260571, 0.246922, 0.522828),
-    vec3(0.258965, 0.251537, 0.524736),
-    vec3(0.257322, 0.256130, 0.526563),
-    vec3(0.255645, 0.260703, 0.528312),
-    vec3(0.253935, 0.265254, 0.529983),
-    vec3(0.252194, 0.269783, 0.531579),
-    vec3(0.250425, 0.274290, 0.533103),
-    vec3(0.248629, 0.278775, 0.534556),
-    vec3(0.246811, 0.283237, 0.535941),
-    vec3(0.244972, 0.287675, 0.537260),
-    vec3(0.243113, 0.292092, 0.538516),
-    vec3(0.241237, 0.296485, 0.539709),
-    vec3(0.239346, 0.300855, 0.540844),
-    vec3(0.237441, 0.305202, 0.541921),
-    vec3(0.235526, 0.309527, 0.542944),
-    vec3(0.233603, 0.313828, 0.543914),
-    vec3(0.231674, 0.318106, 0.544834),
-    vec3(0.229739, 0.322361, 0.545706),
-    vec3(0.227802, 0.326594, 0.546532),
-    vec3(0.225863, 0.330805, 0.547314),
-    vec3(0.223925, 0.334994, 0.548053),
-    vec3(0.221989, 0.339161, 0.548752),
-    vec3(0.220057, 0.343307, 0.549413),
-    vec3(0.218130, 0.347432, 0.550038),
-    vec3(0.216210, 0.351535, 0.550627),
-    vec3(0.214298, 0.355619, 0.551184),
-    vec3(0.212395, 0.359683, 0.551710),
-    vec3(0.210503, 0.363727, 0.552206),
-    vec3(0.208623, 0.367752, 0.552675),
-    vec3(0.206756, 0.371758, 0.553117),
-    vec3(0.204903, 0.375746, 0.553533),
-    vec3(0.203063, 0.379716, 0.553925),
-    vec3(0.201239, 0.383670, 0.554294),
-    vec3(0.199430, 0.387607, 0.554642),
-    vec3(0.197636, 0.391528, 0.554969),
-    vec3(0.195860, 0.395433, 0.555276),
-    vec3(0.194100, 0.399323, 0.555565),
-    vec3(0.192357, 0.403199, 0.555836),
-    vec3(0.190631, 0.407061, 0.556089),
-    vec3(0.188923, 0.410910, 0.556326),
-    vec3(0.187231, 0.414746, 0.556547),
-    vec3(0.185556, 0.418570, 0.556753),
-    vec3(0.183898, 0.422383, 0.556944),
-    vec3(0.182256, 0.426184, 0.557120),
-    vec3(0.180629, 0.429975, 0.557282),
-    vec3(0.179019, 0.433756, 0.557430),
-    vec3(0.177423, 0.437527, 0.557565),
-    vec3(0.175841, 0.441290, 0.557685),
-    vec3(0.174274, 0.445044, 0.557792),
-    vec3(0.172719, 0.448791, 0.557885),
-    vec3(0.171176, 0.452530, 0.557965),
-    vec3(0.169646, 0.456262, 0.558030),
-    vec3(0.168126, 0.459988, 0.558082),
-    vec3(0.166617, 0.463708, 0.558119),
-    vec3(0.165117, 0.467423, 0.558141),
-    vec3(0.163625, 0.471133, 0.558148),
-    vec3(0.162142, 0.474838, 0.558140),
-    vec3(0.160665, 0.478540, 0.558115),
-    vec3(0.159194, 0.482237, 0.558073),
-    vec3(0.157729, 0.485932, 0.558013),
-    vec3(0.156270, 0.489624, 0.557936),
-    vec3(0.154815, 0.493313, 0.557840),
-    vec3(0.153364, 0.497000, 0.557724),
-    vec3(0.151918, 0.500685, 0.557587),
-    vec3(0.150476, 0.504369, 0.557430),
-    vec3(0.149039, 0.508051, 0.557250),
-    vec3(0.147607, 0.511733, 0.557049),
-    vec3(0.146180, 0.515413, 0.556823),
-    vec3(0.144759, 0.519093, 0.556572),
-    vec3(0.143343, 0.522773, 0.556295),
-    vec3(0.141935, 0.526453, 0.555991),
-    vec3(0.140536, 0.530132, 0.555659),
-    vec3(0.139147, 0.533812, 0.555298),
-    vec3(0.137770, 0.537492, 0.554906),
-    vec3(0.136408, 0.541173, 0.554483),
-    vec3(0.135066, 0.544853, 0.554029),
-    vec3(0.133743, 0.548535, 0.553541),
-    vec3(0.132444, 0.552216, 0.553018),
-    vec3(0.131172, 0.555899, 0.552459),
-    vec3(0.129933, 0.559582, 0.551864),
-    vec3(0.128729, 0.563265, 0.551229),
-    vec3(0.127568, 0.566949, 0.550556),
-    vec3(0.126453, 0.570633, 0.549841),
-    vec3(0.125394, 0.574318, 0.549086),
-    vec3(0.124395, 0.578002, 0.548287),
-    vec3(0.123463, 0.581687, 0.547445),
-    vec3(0.122606, 0.585371, 0.546557),
-    vec3(0.121831, 0.589055, 0.545623),
-    vec3(0.121148, 0.592739, 0.544641),
-    vec3(0.120565, 0.596422, 0.543611),
-    vec3(0.120092, 0.600104, 0.542530),
-    vec3(0.119738, 0.603785, 0.541400),
-    vec3(0.119512, 0.607464, 0.540218),
-    vec3(0.119423, 0.611141, 0.538982),
-    vec3(0.119483, 0.614817, 0.537692),
-    vec3(0.119699, 0.618490, 0.536347),
-    vec3(0.120081, 0.622161, 0.534946),
-    vec3(0.120638, 0.625828, 0.533488),
-    vec3(0.121380, 0.629492, 0.531973),
-    vec3(0.122312, 0.633153, 0.530398),
-    vec3(0.123444, 0.636809, 0.528763),
-    vec3(0.124780, 0.640461, 0.527068),
-    vec3(0.126326, 0.644107, 0.525311),
-    vec3(0.128087, 0.647749, 0.523491),
-    vec3(0.130067, 0.651384, 0.521608),
-    vec3(0.132268, 0.655014, 0.519661),
-    vec3(0.134692, 0.658636, 0.517649),
-    vec3(0.137339, 0.662252, 0.515571),
-    vec3(0.140210, 0.665859, 0.513427),
-    vec3(0.143303, 0.669459, 0.511215),
-    vec3(0.146616, 0.673050, 0.508936),
-    vec3(0.150148, 0.676631, 0.506589),
-    vec3(0.153894, 0.680203, 0.504172),
-    vec3(0.157851, 0.683765, 0.501686),
-    vec3(0.162016, 0.687316, 0.499129),
-    vec3(0.166383, 0.690856, 0.496502),
-    vec3(0.170948, 0.694384, 0.493803),
-    vec3(0.175707, 0.697900, 0.491033),
-    vec3(0.180653, 0.701402, 0.488189),
-    vec3(0.185783, 0.704891, 0.485273),
-    vec3(0.191090, 0.708366, 0.482284),
-    vec3(0.196571, 0.711827, 0.479221),
-    vec3(0.202219, 0.715272, 0.476084),
-    vec3(0.208030, 0.718701, 0.472873),
-    vec3(0.214000, 0.722114, 0.469588),
-    vec3(0.220124, 0.725509, 0.466226),
-    vec3(0.226397, 0.728888, 0.462789),
-    vec3(0.232815, 0.732247, 0.459277),
-    vec3(0.239374, 0.735588, 0.455688),
-    vec3(0.246070, 0.738910, 0.452024),
-    vec3(0.252899, 0.742211, 0.448284),
-    vec3(0.259857, 0.745492, 0.444467),
-    vec3(0.266941, 0.748751, 0.440573),
-    vec3(0.274149, 0.751988, 0.436601),
-    vec3(0.281477, 0.755203, 0.432552),
-    vec3(0.288921, 0.758394, 0.428426),
-    vec3(0.296479, 0.761561, 0.424223),
-    vec3(0.304148, 0.764704, 0.419943),
-    vec3(0.311925, 0.767822, 0.415586),
-    vec3(0.319809, 0.770914, 0.411152),
-    vec3(0.327796, 0.773980, 0.40664),
-    vec3(0.335885, 0.777018, 0.402049),
-    vec3(0.344074, 0.780029, 0.397381),
-    vec3(0.352360, 0.783011, 0.392636),
-    vec3(0.360741, 0.785964, 0.387814),
-    vec3(0.369214, 0.788888, 0.382914),
-    vec3(0.377779, 0.791781, 0.377939),
-    vec3(0.386433, 0.794644, 0.372886),
-    vec3(0.395174, 0.797475, 0.367757),
-    vec3(0.404001, 0.800275, 0.362552),
-    vec3(0.412913, 0.803041, 0.357269),
-    vec3(0.421908, 0.805774, 0.351910),
-    vec3(0.430983, 0.808473, 0.346476),
-    vec3(0.440137, 0.811138, 0.340967),
-    vec3(0.449368, 0.813768, 0.335384),
-    vec3(0.458674, 0.816363, 0.329727),
-    vec3(0.468053, 0.818921, 0.323998),
-    vec3(0.477504, 0.821444, 0.318195),
-    vec3(0.487026, 0.823929, 0.312321),
-    vec3(0.496615, 0.826376, 0.306377),
-    vec3(0.506271, 0.828786, 0.300362),
-    vec3(0.515992, 0.831158, 0.294279),
-    vec3(0.525776, 0.833491, 0.288127),
-    vec3(0.535621, 0.835785, 0.281908),
-    vec3(0.545524, 0.838039, 0.275626),
-    vec3(0.555484, 0.840254, 0.269281),
-    vec3(0.565498, 0.842430, 0.262877),
-    vec3(0.575563, 0.844566, 0.256415),
-    vec3(0.585678, 0.846661, 0.249897),
-    vec3(0.595839, 0.848717, 0.243329),
-    vec3(0.606045, 0.850733, 0.236712),
-    vec3(0.616293, 0.852709, 0.230052),
-    vec3(0.626579, 0.854645, 0.223353),
-    vec3(0.636902, 0.856542, 0.216620),
-    vec3(0.647257, 0.858400, 0.209861),
-    vec3(0.657642, 0.860219, 0.203082),
-    vec3(0.668054, 0.861999, 0.196293),
-    vec3(0.678489, 0.863742, 0.189503),
-    vec3(0.688944, 0.865448, 0.182725),
-    vec3(0.699415, 0.867117, 0.175971),
-    vec3(0.709898, 0.868751, 0.169257),
-    vec3(0.720391, 0.870350, 0.162603),
-    vec3(0.730889, 0.871916, 0.156029),
-    vec3(0.741388, 0.873449, 0.149561),
-    vec3(0.751884, 0.874951, 0.143228),
-    vec3(0.762373, 0.876424, 0.137064),
-    vec3(0.772852, 0.877868, 0.131109),
-    vec3(0.783315, 0.879285, 0.125405),
-    vec3(0.793760, 0.880678, 0.120005),
-    vec3(0.804182, 0.882046, 0.114965),
-    vec3(0.814576, 0.883393, 0.110347),
-    vec3(0.824940, 0.884720, 0.106217),
-    vec3(0.835270, 0.886029, 0.102646),
-    vec3(0.845561, 0.887322, 0.099702),
-    vec3(0.855810, 0.888601, 0.097452),
-    vec3(0.866013, 0.889868, 0.095953),
-    vec3(0.876168, 0.891125, 0.095250),
-    vec3(0.886271, 0.892374, 0.095374),
-    vec3(0.896320, 0.893616, 0.096335),
-    vec3(0.906311, 0.894855, 0.098125),
-    vec3(0.916242, 0.896091, 0.100717),
-    vec3(0.926106, 0.897330, 0.104071),
-    vec3(0.935904, 0.898570, 0.108131),
-    vec3(0.945636, 0.899815, 0.112838),
-    vec3(0.955360, 0.901065, 0.118128),
-    vec3(0.964894, 0.902323, 0.123941),
-    vec3(0.974417, 0.903590, 0.130215),
-    vec3(0.983868, 0.904867, 0.136897),
-    vec3(0.993248, 0.906157, 0.143936)
-);
-
-const vec3 PLASMA_COLORS[PLASMA_STOPS] = vec3[](
-    vec3(0.050383, 0.029803, 0.527975),
-    vec3(0.063536, 0.028426, 0.533124),
-    vec3(0.075353, 0.027206, 0.538007),
-    vec3(0.086222, 0.026125, 0.542658),
-    vec3(0.096379, 0.025165, 0.547103),
-    vec3(0.105980, 0.024309, 0.551368),
-    vec3(0.115124, 0.023556, 0.555468),
-    vec3(0.123903, 0.022878, 0.559423),
-    vec3(0.132381, 0.022258, 0.563250),
-    vec3(0.140603, 0.021687, 0.566959),
-    vec3(0.148607, 0.021154, 0.570562),
-    vec3(0.156421, 0.020651, 0.574065),
-    vec3(0.164070, 0.020171, 0.577478),
-    vec3(0.171574, 0.019706, 0.580806),
-    vec3(0.178950, 0.019252, 0.584054),
-    vec3(0.186213, 0.018803, 0.587228),
-    vec3(0.193374, 0.018354, 0.590330),
-    vec3(0.200445, 0.017902, 0.593364),
-    vec3(0.207435, 0.017442, 0.596333),
-    vec3(0.214350, 0.016973, 0.599239),
-    vec3(0.221197, 0.016497, 0.602083),
-    vec3(0.227983, 0.016007, 0.604867),
-    vec3(0.234715, 0.015502, 0.607592),
-    vec3(0.241396, 0.014979, 0.610259),
-    vec3(0.248032, 0.014439, 0.612868),
-    vec3(0.254627, 0.013882, 0.615419),
-    vec3(0.261183, 0.013308, 0.617911),
-    vec3(0.267703, 0.012716, 0.620346),
-    vec3(0.274191, 0.012109, 0.622722),
-    vec3(0.280648, 0.011488, 0.625038),
-    vec3(0.287076, 0.010855, 0.627295),
-    vec3(0.293478, 0.010213, 0.629490),
-    vec3(0.299855, 0.009561, 0.631624),
-    vec3(0.306210, 0.008902, 0.633694),
-    vec3(0.312543, 0.008239, 0.635700),
-    vec3(0.318856, 0.007576, 0.637640),
-    vec3(0.325150, 0.006915, 0.639512),
-    vec3(0.331426, 0.006261, 0.641316),
-    vec3(0.337683, 0.005618, 0.643049),
-    vec3(0.343925, 0.004991, 0.644710),
-    vec3(0.350150, 0.004382, 0.646298),
-    vec3(0.356359, 0.003798, 0.647810),
-    vec3(0.362553, 0.003243, 0.649245),
-    vec3(0.368733, 0.002724, 0.650601),
-    vec3(0.374897, 0.002245, 0.651876),
-    vec3(0.381047, 0.001814, 0.653068),
-    vec3(0.387183, 0.001434, 0.654177),
-    vec3(0.393304, 0.001114, 0.655199),
-    vec3(0.399411, 0.000859, 0.656133),
-    vec3(0.405503, 0.000678, 0.656977),
-    vec3(0.411580, 0.000577, 0.657730),
-    vec3(0.417642, 0.000564, 0.658390),
-    vec3(0.423689, 0.000646, 0.658956),
-    vec3(0.429719, 0.000831, 0.659425),
-    vec3(0.435734, 0.001127, 0.659797),
-    vec3(0.441732, 0.001540, 0.660069),
-    vec3(0.447714, 0.002080, 0.660240),
-    vec3(0.453677, 0.002755, 0.660310),
-    vec3(0.459623, 0.003574, 0.660277),
-    vec3(0.465550, 0.004545, 0.660139),
-    vec3(0.471457, 0.005678, 0.659897),
-    vec3(0.477344, 0.006980, 0.659549),
-    vec3(0.483210, 0.008460, 0.659095),
-    vec3(0.489055, 0.010127, 0.658534),
-    vec3(0.494877, 0.011990, 0.657865),
-    vec3(0.500678, 0.014055, 0.657088),
-    vec3(0.506454, 0.016333, 0.656202),
-    vec3(0.512206, 0.018833, 0.655209),
-    vec3(0.517933, 0.021563, 0.654109),
-    vec3(0.523633, 0.024532, 0.652901),
-    vec3(0.529306, 0.027747, 0.651586),
-    vec3(0.534952, 0.031217, 0.650165),
-    vec3(0.540570, 0.034950, 0.648640),
-    vec3(0.546157, 0.038954, 0.647010),
-    vec3(0.551715, 0.043136, 0.645277),
-    vec3(0.557243, 0.047331, 0.643443),
-    vec3(0.562738, 0.051545, 0.641509),
-    vec3(0.568201, 0.055778, 0.639477),
-    vec3(0.573632, 0.060028, 0.637349),
-    vec3(0.579029, 0.064296, 0.635126),
-    vec3(0.584391, 0.068579, 0.632812),
-    vec3(0.589719, 0.072878, 0.630408),
-    vec3(0.595011, 0.077190, 0.627917),
-    vec3(0.600266, 0.081516, 0.625342),
-    vec3(0.605485, 0.085854, 0.622686),
-    vec3(0.610667, 0.090204, 0.619951),
-    vec3(0.615812, 0.094564, 0.617140),
-    vec3(0.620919, 0.098934, 0.614257),
-    vec3(0.625987, 0.103312, 0.611305),
-    vec3(0.631017, 0.107699, 0.608287),
-    vec3(0.636008, 0.112092, 0.605205),
-    vec3(0.640959, 0.116492, 0.602065),
-    vec3(0.645872, 0.120898, 0.598867),
-    vec3(0.650746, 0.125309, 0.595617),
-    vec3(0.655580, 0.129725, 0.592317),
-    vec3(0.660374, 0.134144, 0.588971),
-    vec3(0.665129, 0.138566, 0.585582),
-    vec3(0.669845, 0.142992, 0.582154),
-    vec3(0.674522, 0.147419, 0.578688),
-    vec3(0.679160, 0.151848, 0.575189),
-    vec3(0.683758, 0.156278, 0.571660),
-    vec3(0.688318, 0.160709, 0.568103),
-    vec3(0.692840, 0.165141, 0.564522),
-    vec3(0.697324, 0.169573, 0.560919),
-    vec3(0.701769, 0.174005, 0.557296),
-    vec3(0.706178, 0.178437, 0.553657),
-    vec3(0.710549, 0.182868, 0.550004),
-    vec3(0.714883, 0.187299, 0.546338),
-    vec3(0.719181, 0.191729, 0.542663),
-    vec3(0.723444, 0.196158, 0.538981),
-    vec3(0.727670, 0.200586, 0.535293),
-    vec3(0.731862, 0.205013, 0.531601),
-    vec3(0.736019, 0.209439, 0.527908),
-    vec3(0.740143, 0.213864, 0.524216),
-    vec3(0.744232, 0.218288, 0.520524),
-    vec3(0.748289, 0.222711, 0.516834),
-    vec3(0.752312, 0.227133, 0.513149),
-    vec3(0.756304, 0.231555, 0.509468),
-    vec3(0.760264, 0.235976, 0.505794),
-    vec3(0.764193, 0.240396, 0.502126),
-    vec3(0.768090, 0.244817, 0.498465),
-    vec3(0.771958, 0.249237, 0.494813),
-    vec3(0.775796, 0.253658, 0.491171),
-    vec3(0.779604, 0.258078, 0.487539),
-    vec3(0.783383, 0.262500, 0.483918),
-    vec3(0.787133, 0.266922, 0.480307),
-    vec3(0.790855, 0.271345, 0.476706),
-    vec3(0.794549, 0.275770, 0.473117),
-    vec3(0.798216, 0.280197, 0.469538),
-    vec3(0.801855, 0.284626, 0.465971),
-    vec3(0.805467, 0.289057, 0.462415),
-    vec3(0.809052, 0.293491, 0.458870),
-    vec3(0.812612, 0.297928, 0.455338),
-    vec3(0.816144, 0.302368, 0.451816),
-    vec3(0.819651, 0.306812, 0.448306),
-    vec3(0.823132, 0.311261, 0.444806),
-    vec3(0.826588, 0.315714, 0.441316),
-    vec3(0.830018, 0.320172, 0.437836),
-    vec3(0.833422, 0.324635, 0.434366),
-    vec3(0.836801, 0.329105, 0.430905),
-    vec3(0.840155, 0.333580, 0.427455),
-    vec3(0.843484, 0.338062, 0.424013),
-    vec3(0.846788, 0.342551, 0.420579),
-    vec3(0.850066, 0.347048, 0.417153),
-    vec3(0.853319, 0.351553, 0.413734),
-    vec3(0.856547, 0.356066, 0.410322),
-    vec3(0.859750, 0.360588, 0.406917),
-    vec3(0.862927, 0.365119, 0.403519),
-    vec3(0.866078, 0.369660, 0.400126),
-    vec3(0.869203, 0.374212, 0.396738),
-    vec3(0.872303, 0.378774, 0.393355),
-    vec3(0.875376, 0.383347, 0.389976),
-    vec3(0.878423, 0.387932, 0.386600),
-    vec3(0.881443, 0.392529, 0.383229),
-    vec3(0.884436, 0.397139, 0.379860),
-    vec3(0.887402, 0.401762, 0.376494),
-    vec3(0.890340, 0.406398, 0.373130),
-    vec3(0.893250, 0.411048, 0.369768),
-    vec3(0.896131, 0.415712, 0.366407),
-    vec3(0.898984, 0.420392, 0.363047),
-    vec3(0.901807, 0.425087, 0.359688),
-    vec3(0.904601, 0.429797, 0.356329),
-    vec3(0.907365, 0.434524, 0.352970),
-    vec3(0.910098, 0.439268, 0.349610),
-    vec3(0.912800, 0.444029, 0.346251),
-    vec3(0.915471, 0.448807, 0.342890),
-    vec3(0.918109, 0.453603, 0.339529),
-    vec3(0.920714, 0.458417, 0.336166),
-    vec3(0.923287, 0.463251, 0.332801),
-    vec3(0.925825, 0.468103, 0.329435),
-    vec3(0.928329, 0.472975, 0.326067),
-    vec3(0.930798, 0.477867, 0.322697),
-    vec3(0.933232, 0.482780, 0.319325),
-    vec3(0.935630, 0.487712, 0.315952),
-    vec3(0.937990, 0.492667, 0.312575),
-    vec3(0.940313, 0.497642, 0.309197),
-    vec3(0.942598, 0.502639, 0.305816),
-    vec3(0.944844, 0.507658, 0.302433),
-    vec3(0.947051, 0.512699, 0.299049),
-    vec3(0.949217, 0.517763, 0.295662),
-    vec3(0.951344, 0.522850, 0.292275),
-    vec3(0.953428, 0.527960, 0.288883),
-    vec3(0.955470, 0.533093, 0.285490),
-    vec3(0.957469, 0.538250, 0.282096),
-    vec3(0.959424, 0.543431, 0.278701),
-    vec3(0.961336, 0.548636, 0.275305),
-    vec3(0.963203, 0.553865, 0.271909),
-    vec3(0.965024, 0.559118, 0.268513),
-    vec3(0.966798, 0.564396, 0.265118),
-    vec3(0.968526, 0.569700, 0.261721),
-    vec3(0.970205, 0.575028, 0.258325),
-    vec3(0.971835, 0.580382, 0.254931),
-    vec3(0.973416, 0.585761, 0.251540),
-    vec3(0.974947, 0.591165, 0.248151),
-    vec3(0.976428, 0.596595, 0.244767),
-    vec3(0.977856, 0.602051, 0.241387),
-    vec3(0.979233, 0.607532, 0.238013),
-    vec3(0.980556, 0.613039, 0.234646),
-    vec3(0.981826, 0.618572, 0.231287),
-    vec3(0.983041, 0.624131, 0.227937),
-    vec3(0.984199, 0.629718, 0.224595),
-    vec3(0.985301, 0.635330, 0.221265),
-    vec3(0.986345, 0.640969, 0.217948),
-    vec3(0.987332, 0.646633, 0.214648),
-    vec3(0.988260, 0.652325, 0.211364),
-    vec3(0.989128, 0.658043, 0.208100),
-    vec3(0.989935, 0.663787, 0.204859),
-    vec3(0.990681, 0.669558, 0.201642),
-    vec3(0.991365, 0.675355, 0.198453),
-    vec3(0.991985, 0.681179, 0.195295),
-    vec3(0.992541, 0.687030, 0.192170),
-    vec3(0.993032, 0.692907, 0.189084),
-    vec3(0.993456, 0.698810, 0.186041),
-    vec3(0.993814, 0.704741, 0.183043),
-    vec3(0.994103, 0.710698, 0.180097),
-    vec3(0.994324, 0.716681, 0.177208),
-    vec3(0.994474, 0.722691, 0.174381),
-    vec3(0.994553, 0.728728, 0.171622),
-    vec3(0.994561, 0.734791, 0.168938),
-    vec3(0.994495, 0.740880, 0.166335),
-    vec3(0.994355, 0.746995, 0.163821),
-    vec3(0.994141, 0.753137, 0.161404),
-    vec3(0.993851, 0.759304, 0.159092),
-    vec3(0.993482, 0.765499, 0.156891),
-    vec3(0.993033, 0.771720, 0.154808),
-    vec3(0.992505, 0.777967, 0.152855),
-    vec3(0.991897, 0.784239, 0.151042),
-    vec3(0.991209, 0.790537, 0.149377),
-    vec3(0.990439, 0.796859, 0.147870),
-    vec3(0.989587, 0.803205, 0.146529),
-    vec3(0.988648, 0.809579, 0.145357),
-    vec3(0.987621, 0.815978, 0.144363),
-    vec3(0.986509, 0.822401, 0.143557),
-    vec3(0.985314, 0.828846, 0.142945),
-    vec3(0.984031, 0.835315, 0.142528),
-    vec3(0.982653, 0.841812, 0.142303),
-    vec3(0.981190, 0.848329, 0.142279),
-    vec3(0.979644, 0.854866, 0.142453),
-    vec3(0.977995, 0.861432, 0.142808),
-    vec3(0.976265, 0.868016, 0.143351),
-    vec3(0.974443, 0.874622, 0.144061),
-    vec3(0.972530, 0.881250, 0.144923),
-    vec3(0.970533, 0.887896, 0.145919),
-    vec3(0.968443, 0.894564, 0.147014),
-    vec3(0.966271, 0.901249, 0.148180),
-    vec3(0.964021, 0.907950, 0.149370),
-    vec3(0.961681, 0.914672, 0.150520),
-    vec3(0.959276, 0.921407, 0.151566),
-    vec3(0.956808, 0.928152, 0.152409),
-    vec3(0.954287, 0.934908, 0.152921),
-    vec3(0.951726, 0.941671, 0.152925),
-    vec3(0.949151, 0.948435, 0.152178),
-    vec3(0.946602, 0.955190, 0.150328),
-    vec3(0.944152, 0.961916, 0.146861),
-    vec3(0.941896, 0.968590, 0.140956),
-    vec3(0.940015, 0.975158, 0.131326)
-);
-
-const vec3 INFERNO_COLORS[INFERNO_STOPS] = vec3[](
-    vec3(0.001462, 0.000466, 0.013866),
-    vec3(0.002267, 0.001270, 0.018570),
-    vec3(0.003299, 0.002249, 0.024239),
-    vec3(0.004547, 0.003392, 0.030909),
-    vec3(0.006006, 0.004692, 0.038558),
-    vec3(0.007676, 0.006136, 0.046836),
-    vec3(0.009561, 0.007713, 0.055143),
-    vec3(0.011663, 0.009417, 0.063460),
-    vec3(0.013995, 0.011225, 0.071862),
-    vec3(0.016561, 0.013136, 0.080282),
-    vec3(0.019373, 0.015133, 0.088767),
-    vec3(0.022447, 0.017199, 0.097327),
-    vec3(0.025793, 0.019331, 0.105930),
-    vec3(0.029432, 0.021503, 0.114621),
-    vec3(0.033385, 0.023702, 0.123397),
-    vec3(0.037668, 0.025921, 0.132232),
-    vec3(0.042253, 0.028139, 0.141141),
-    vec3(0.046915, 0.030324, 0.150164),
-    vec3(0.051644, 0.032474, 0.159254),
-    vec3(0.056449, 0.034569, 0.168414),
-    vec3(0.061340, 0.036590, 0.177642),
-    vec3(0.066331, 0.038504, 0.186962),
-    vec3(0.071429, 0.040294, 0.196354),
-    vec3(0.076637, 0.041905, 0.205799),
-    vec3(0.081962, 0.043328, 0.215289),
-    vec3(0.087411, 0.044556, 0.224813),
-    vec3(0.092990, 0.045583, 0.234358),
-    vec3(0.098702, 0.046402, 0.243904),
-    vec3(0.104551, 0.047008, 0.253430),
-    vec3(0.110536, 0.047399, 0.262912),
-    vec3(0.116656, 0.047574, 0.272321),
-    vec3(0.122908, 0.047536, 0.281624),
-    vec3(0.129285, 0.047293, 0.290788),
-    vec3(0.135778, 0.046856, 0.299776),
-    vec3(0.142378, 0.046242, 0.308553),
-    vec3(0.149073, 0.045468, 0.317085),
-    vec3(0.155850, 0.044559, 0.325338),
-    vec3(0.162689, 0.043554, 0.333277),
-    vec3(0.169575, 0.042489, 0.340874),
-    vec3(0.176493, 0.041402, 0.348111),
-    vec3(0.183429, 0.040329, 0.354971),
-    vec3(0.190367, 0.039309, 0.361447),
-    vec3(0.197297, 0.038400, 0.367535),
-    vec3(0.204209, 0.037632, 0.373238),
-    vec3(0.211095, 0.037030, 0.378563),
-    vec3(0.217949, 0.036615, 0.383522),
-    vec3(0.224763, 0.036405, 0.388129),
-    vec3(0.231538, 0.036405, 0.392400),
-    vec3(0.238273, 0.036621, 0.396353),
-    vec3(0.244967, 0.037055, 0.400007),
-    vec3(0.251620, 0.037705, 0.403378),
-    vec3(0.258234, 0.038571, 0.406485),
-    vec3(0.264810, 0.039647, 0.409345),
-    vec3(0.271347, 0.040922, 0.411976),
-    vec3(0.277850, 0.042353, 0.414392),
-    vec3(0.284321, 0.043933, 0.416608),
-    vec3(0.290763, 0.045644, 0.418637),
-    vec3(0.297178, 0.047470, 0.420491),
-    vec3(0.303568, 0.049396, 0.422182),
-    vec3(0.309935, 0.051407, 0.423721),
-    vec3(0.316282, 0.053490, 0.425116),
-    vec3(0.322610, 0.055634, 0.426377),
-    vec3(0.328921, 0.057827, 0.427511),
-    vec3(0.335217, 0.060060, 0.428524),
-    vec3(0.341500, 0.062325, 0.429425),
-    vec3(0.347771, 0.064616, 0.430217),
-    vec3(0.354032, 0.066925, 0.430906),
-    vec3(0.360284, 0.069247, 0.431497),
-    vec3(0.366529, 0.071579, 0.431994),
-    vec3(0.372768, 0.073915, 0.432400),
-    vec3(0.379001, 0.076253, 0.432719),
-    vec3(0.385228, 0.078591, 0.432955),
-    vec3(0.391453, 0.080927, 0.433109),
-    vec3(0.397674, 0.083257, 0.433183),
-    vec3(0.403894, 0.085580, 0.433179),
-    vec3(0.410113, 0.087896, 0.433098),
-    vec3(0.416331, 0.090203, 0.432943),
-    vec3(0.422549, 0.092501, 0.432714),
-    vec3(0.428768, 0.094790, 0.432412),
-    vec3(0.434987, 0.097069, 0.432039),
-    vec3(0.441207, 0.099338, 0.431594),
-    vec3(0.447428, 0.101597, 0.431080),
-    vec3(0.453651, 0.103848, 0.430498),
-    vec3(0.459875, 0.106089, 0.429846),
-    vec3(0.466100, 0.108322, 0.429125),
-    vec3(0.472328, 0.110547, 0.428334),
-    vec3(0.478558, 0.112764, 0.427475),
-    vec3(0.484789, 0.114974, 0.426548),
-    vec3(0.491022, 0.117179, 0.425552),
-    vec3(0.497257, 0.119379, 0.424488),
-    vec3(0.503493, 0.121575, 0.423356),
-    vec3(0.509730, 0.123769, 0.422156),
-    vec3(0.515967, 0.125960, 0.420887),
-    vec3(0.522206, 0.128150, 0.419549),
-    vec3(0.528444, 0.130341, 0.418142),
-    vec3(0.534683, 0.132534, 0.416667),
-    vec3(0.540920, 0.134729, 0.415123),
-    vec3(0.547157, 0.136929, 0.413511),
-    vec3(0.553392, 0.139134, 0.411829),
-    vec3(0.559624, 0.141346, 0.410078),
-    vec3(0.565854, 0.143567, 0.408258),
-    vec3(0.572081, 0.145797, 0.406369),
-    vec3(0.578304, 0.148039, 0.404411),
-    vec3(0.584521, 0.150294, 0.402385),
-    vec3(0.590734, 0.152563, 0.400290),
-    vec3(0.596940, 0.154848, 0.398125),
-    vec3(0.603139, 0.157151, 0.395891),
-    vec3(0.609330, 0.159474, 0.393589),
-    vec3(0.615513, 0.161817, 0.391219),
-    vec3(0.621685, 0.164184, 0.388781),
-    vec3(0.627847, 0.166575, 0.386276),
-    vec3(0.633998, 0.168992, 0.383704),
-    vec3(0.640135, 0.171438, 0.381065),
-    vec3(0.646260, 0.173914, 0.378359),
-    vec3(0.652369, 0.176421, 0.375586),
-    vec3(0.658463, 0.178962, 0.372748),
-    vec3(0.664540, 0.181539, 0.369846),
-    vec3(0.670599, 0.184153, 0.366879),
-    vec3(0.676638, 0.186807, 0.363849),
-    vec3(0.682656, 0.189501, 0.360757),
-    vec3(0.688653, 0.192239, 0.357603),
-    vec3(0.694627, 0.195021, 0.354388),
-    vec3(0.700576, 0.197851, 0.351113),
-    vec3(0.706500, 0.200728, 0.347777),
-    vec3(0.712396, 0.203656, 0.344383),
-    vec3(0.718264, 0.206636, 0.340931),
-    vec3(0.724103, 0.209670, 0.337424),
-    vec3(0.729909, 0.212759, 0.333861),
-    vec3(0.735683, 0.215906, 0.330245),
-    vec3(0.741423, 0.219112, 0.326576),
-    vec3(0.747127, 0.222378, 0.322856),
-    vec3(0.752794, 0.225706, 0.319085),
-    vec3(0.758422, 0.229097, 0.315266),
-    vec3(0.764010, 0.232554, 0.311399),
-    vec3(0.769556, 0.236077, 0.307485),
-    vec3(0.775059, 0.239667, 0.303526),
-    vec3(0.780517, 0.243327, 0.299523),
-    vec3(0.785929, 0.247056, 0.295477),
-    vec3(0.791293, 0.250856, 0.291390),
-    vec3(0.796607, 0.254728, 0.287264),
-    vec3(0.801871, 0.258674, 0.283099),
-    vec3(0.807082, 0.262692, 0.278898),
-    vec3(0.812239, 0.266786, 0.274661),
-    vec3(0.817341, 0.270954, 0.270390),
-    vec3(0.822386, 0.275197, 0.266085),
-    vec3(0.827372, 0.279517, 0.261750),
-    vec3(0.832299, 0.283913, 0.257383),
-    vec3(0.837165, 0.288385, 0.252988),
-    vec3(0.841969, 0.292933, 0.248564),
-    vec3(0.846709, 0.297559, 0.244113),
-    vec3(0.851384, 0.302260, 0.239636),
-    vec3(0.855992, 0.307038, 0.235133),
-    vec3(0.860533, 0.311892, 0.230606),
-    vec3(0.865006, 0.316822, 0.226055),
-    vec3(0.869409, 0.321827, 0.221482),
-    vec3(0.873741, 0.326906, 0.216886),
-    vec3(0.878001, 0.332060, 0.212268),
-    vec3(0.882188, 0.337287, 0.207628),
-    vec3(0.886302, 0.342586, 0.202968),
-    vec3(0.890341, 0.347957, 0.198286),
-    vec3(0.894305, 0.353399, 0.193584),
-    vec3(0.898192, 0.358911, 0.188860),
-    vec3(0.902003, 0.364492, 0.184116),
-    vec3(0.905735, 0.370140, 0.179350),
-    vec3(0.909390, 0.375856, 0.174563),
-    vec3(0.912966, 0.381636, 0.169755),
-    vec3(0.916462, 0.387481, 0.164924),
-    vec3(0.919879, 0.393389, 0.160070),
-    vec3(0.923215, 0.399359, 0.155193),
-    vec3(0.926470, 0.405389, 0.150292),
-    vec3(0.929644, 0.411479, 0.145367),
-    vec3(0.932737, 0.417627, 0.140417),
-    vec3(0.935747, 0.423831, 0.135440),
-    vec3(0.938675, 0.430091, 0.130438),
-    vec3(0.941521, 0.436405, 0.125409),
-    vec3(0.944285, 0.442772, 0.120354),
-    vec3(0.946965, 0.449191, 0.115272),
-    vec3(0.949562, 0.455660, 0.110164),
-    vec3(0.952075, 0.462178, 0.105031),
-    vec3(0.954506, 0.468744, 0.099874),
-    vec3(0.956852, 0.475356, 0.094695),
-    vec3(0.959114, 0.482014, 0.089499),
-    vec3(0.961293, 0.488716, 0.084289),
-    vec3(0.963387, 0.495462, 0.079073),
-    vec3(0.965397, 0.502249, 0.073859),
-    vec3(0.967322, 0.509078, 0.068659),
-    vec3(0.969163, 0.515946, 0.063488),
-    vec3(0.970919, 0.522853, 0.058367),
-    vec3(0.972590, 0.529798, 0.053324),
-    vec3(0.974176, 0.536780, 0.048392),
-    vec3(0.975677, 0.543798, 0.043618),
-    vec3(0.977092, 0.550850, 0.039050),
-    vec3(0.978422, 0.557937, 0.034931),
-    vec3(0.979666, 0.565057, 0.031409),
-    vec3(0.980824, 0.572209, 0.028508),
-    vec3(0.981895, 0.579392, 0.026250),
-    vec3(0.982881, 0.586606, 0.024661),
-    vec3(0.983779, 0.593849, 0.023770),
-    vec3(0.984591, 0.601122, 0.023606),
-    vec3(0.985315, 0.608422, 0.024202),
-    vec3(0.985952, 0.615750, 0.025592),
-    vec3(0.986502, 0.623105, 0.027814),
-    vec3(0.986964, 0.630485, 0.030908),
-    vec3(0.987337, 0.637890, 0.034916),
-    vec3(0.987622, 0.645320, 0.039886),
-    vec3(0.987819, 0.652773, 0.045581),
-    vec3(0.987926, 0.660250, 0.051750),
-    vec3(0.987945, 0.667748, 0.058329),
-    vec3(0.987874, 0.675267, 0.065257),
-    vec3(0.987714, 0.682807, 0.072489),
-    vec3(0.987464, 0.690366, 0.079990),
-    vec3(0.987124, 0.697944, 0.087731),
-    vec3(0.986694, 0.705540, 0.095694),
-    vec3(0.986175, 0.713153, 0.103863),
-    vec3(0.985566, 0.720782, 0.112229),
-    vec3(0.984865, 0.728427, 0.120785),
-    vec3(0.984075, 0.736087, 0.129527),
-    vec3(0.983196, 0.743758, 0.138453),
-    vec3(0.982228, 0.751442, 0.147565),
-    vec3(0.981173, 0.759135, 0.156863),
-    vec3(0.980032, 0.766837, 0.166353),
-    vec3(0.978806, 0.774545, 0.176037),
-    vec3(0.977497, 0.782258, 0.185923),
-    vec3(0.976108, 0.789974, 0.196018),
-    vec3(0.974638, 0.797692, 0.206332),
-    vec3(0.973088, 0.805409, 0.216877),
-    vec3(0.971468, 0.813122, 0.227658),
-    vec3(0.969783, 0.820825, 0.238686),
-    vec3(0.968041, 0.828515, 0.249972),
-    vec3(0.966243, 0.836191, 0.261534),
-    vec3(0.964394, 0.843848, 0.273391),
-    vec3(0.962517, 0.851476, 0.285546),
-    vec3(0.960626, 0.859069, 0.298010),
-    vec3(0.958720, 0.866624, 0.310820),
-    vec3(0.956834, 0.874129, 0.323974),
-    vec3(0.954997, 0.881569, 0.337475),
-    vec3(0.953215, 0.888942, 0.351369),
-    vec3(0.951546, 0.896226, 0.365627),
-    vec3(0.950018, 0.903409, 0.380271),
-    vec3(0.948683, 0.910473, 0.395289),
-    vec3(0.947594, 0.917399, 0.410665),
-    vec3(0.946809, 0.924168, 0.426373),
-    vec3(0.946392, 0.930761, 0.442367),
-    vec3(0.946403, 0.937159, 0.458592),
-    vec3(0.946903, 0.943348, 0.474970),
-    vec3(0.947937, 0.949318, 0.491426),
-    vec3(0.949545, 0.955063, 0.507860),
-    vec3(0.951740, 0.960587, 0.524203),
-    vec3(0.954529, 0.965896, 0.540361),
-    vec3(0.957896, 0.971003, 0.556275),
-    vec3(0.961812, 0.975924, 0.571925),
-    vec3(0.966249, 0.980678, 0.587206),
-    vec3(0.971162, 0.985282, 0.602154),
-    vec3(0.976511, 0.989753, 0.616760),
-    vec3(0.982257, 0.994109, 0.631017),
-    vec3(0.988362, 0.998364, 0.644924)
-);
-
-const vec3 MAGMA_COLORS[MAGMA_STOPS] = vec3[](
-    vec3(0.001462, 0.000466, 0.013866),
-    vec3(0.002258, 0.001295, 0.018331),
-    vec3(0.003279, 0.002305, 0.023708),
-    vec3(0.004512, 0.003490, 0.029965),
-    vec3(0.005950, 0.004843, 0.037130),
-    vec3(0.007588, 0.006356, 0.044973),
-    vec3(0.009426, 0.008022, 0.052844),
-    vec3(0.011465, 0.009828, 0.060750),
-    vec3(0.013708, 0.011771, 0.068667),
-    vec3(0.016156, 0.013840, 0.076603),
-    vec3(0.018815, 0.016026, 0.084584),
-    vec3(0.021692, 0.018320, 0.092610),
-    vec3(0.024792, 0.020715, 0.100676),
-    vec3(0.028123, 0.023201, 0.108787),
-    vec3(0.031696, 0.025765, 0.116965),
-    vec3(0.035520, 0.028397, 0.125209),
-    vec3(0.039608, 0.031090, 0.133515),
-    vec3(0.043830, 0.033830, 0.141886),
-    vec3(0.048062, 0.036607, 0.150327),
-    vec3(0.052320, 0.039407, 0.158841),
-    vec3(0.056615, 0.042160, 0.167446),
-    vec3(0.060949, 0.044794, 0.176129),
-    vec3(0.065330, 0.047318, 0.184892),
-    vec3(0.069764, 0.049726, 0.193735),
-    vec3(0.074257, 0.052017, 0.202660),
-    vec3(0.078815, 0.054184, 0.211667),
-    vec3(0.083446, 0.056225, 0.220755),
-    vec3(0.088155, 0.058133, 0.229922),
-    vec3(0.092949, 0.059904, 0.239164),
-    vec3(0.097833, 0.061531, 0.248477),
-    vec3(0.102815, 0.063010, 0.257854),
-    vec3(0.107899, 0.064335, 0.267289),
-    vec3(0.113094, 0.065492, 0.276784),
-    vec3(0.118405, 0.066479, 0.286321),
-    vec3(0.123833, 0.067295, 0.295879),
-    vec3(0.129380, 0.067935, 0.305443),
-    vec3(0.135053, 0.068391, 0.315000),
-    vec3(0.140858, 0.068654, 0.324538),
-    vec3(0.146785, 0.068738, 0.334011),
-    vec3(0.152839, 0.068637, 0.343404),
-    vec3(0.159018, 0.068354, 0.352688),
-    vec3(0.165308, 0.067911, 0.361816),
-    vec3(0.171713, 0.067305, 0.370771),
-    vec3(0.178212, 0.066576, 0.379497),
-    vec3(0.184801, 0.065732, 0.387973),
-    vec3(0.191460, 0.064818, 0.396152),
-    vec3(0.198177, 0.063862, 0.404009),
-    vec3(0.204935, 0.062907, 0.411514),
-    vec3(0.211718, 0.061992, 0.418647),
-    vec3(0.218512, 0.061158, 0.425392),
-    vec3(0.225302, 0.060445, 0.431742),
-    vec3(0.232077, 0.059889, 0.437695),
-    vec3(0.238826, 0.059517, 0.443256),
-    vec3(0.245543, 0.059352, 0.448436),
-    vec3(0.252220, 0.059415, 0.453248),
-    vec3(0.258857, 0.059706, 0.457710),
-    vec3(0.265447, 0.060237, 0.461840),
-    vec3(0.271994, 0.060994, 0.465660),
-    vec3(0.278493, 0.061978, 0.469190),
-    vec3(0.284951, 0.063168, 0.472451),
-    vec3(0.291366, 0.064553, 0.475462),
-    vec3(0.297740, 0.066117, 0.478243),
-    vec3(0.304081, 0.067835, 0.480812),
-    vec3(0.310382, 0.069702, 0.483186),
-    vec3(0.316654, 0.071690, 0.485380),
-    vec3(0.322899, 0.073782, 0.487408),
-    vec3(0.329114, 0.075972, 0.489287),
-    vec3(0.335308, 0.078236, 0.491024),
-    vec3(0.341482, 0.080564, 0.492631),
-    vec3(0.347636, 0.082946, 0.494121),
-    vec3(0.353773, 0.085373, 0.495501),
-    vec3(0.359898, 0.087831, 0.496778),
-    vec3(0.366012, 0.090314, 0.497960),
-    vec3(0.372116, 0.092816, 0.499053),
-    vec3(0.378211, 0.095332, 0.500067),
-    vec3(0.384299, 0.097855, 0.501002),
-    vec3(0.390384, 0.100379, 0.501864),
-    vec3(0.396467, 0.102902, 0.502658),
-    vec3(0.402548, 0.105420, 0.503386),
-    vec3(0.408629, 0.107930, 0.504052),
-    vec3(0.414709, 0.110431, 0.504662),
-    vec3(0.420791, 0.112920, 0.505215),
-    vec3(0.426877, 0.115395, 0.505714),
-    vec3(0.432967, 0.117855, 0.506160),
-    vec3(0.439062, 0.120298, 0.506555),
-    vec3(0.445163, 0.122724, 0.506901),
-    vec3(0.451271, 0.125132, 0.507198),
-    vec3(0.457386, 0.127522, 0.507448),
-    vec3(0.463508, 0.129893, 0.507652),
-    vec3(0.469640, 0.132245, 0.507809),
-    vec3(0.475780, 0.134577, 0.507921),
-    vec3(0.481929, 0.136891, 0.507989),
-    vec3(0.488088, 0.139186, 0.508011),
-    vec3(0.494258, 0.141462, 0.507988),
-    vec3(0.500438, 0.143719, 0.507920),
-    vec3(0.506629, 0.145958, 0.507806),
-    vec3(0.512831, 0.148179, 0.507648),
-    vec3(0.519045, 0.150383, 0.507443),
-    vec3(0.525270, 0.152569, 0.507192),
-    vec3(0.531507, 0.154739, 0.506895),
-    vec3(0.537755, 0.156894, 0.506551),
-    vec3(0.544015, 0.159033, 0.506159),
-    vec3(0.550287, 0.161158, 0.505719),
-    vec3(0.556571, 0.163269, 0.505230),
-    vec3(0.562866, 0.165368, 0.504692),
-    vec3(0.569172, 0.167454, 0.504105),
-    vec3(0.575490, 0.169530, 0.503466),
-    vec3(0.581819, 0.171596, 0.502777),
-    vec3(0.588158, 0.173652, 0.502035),
-    vec3(0.594508, 0.175701, 0.501241),
-    vec3(0.600868, 0.177743, 0.500394),
-    vec3(0.607238, 0.179779, 0.499492),
-    vec3(0.613617, 0.181811, 0.498536),
-    vec3(0.620005, 0.183840, 0.497524),
-    vec3(0.626401, 0.185867, 0.496456),
-    vec3(0.632805, 0.187893, 0.495332),
-    vec3(0.639216, 0.189921, 0.494150),
-    vec3(0.645633, 0.191952, 0.492910),
-    vec3(0.652056, 0.193986, 0.491611),
-    vec3(0.658483, 0.196027, 0.490253),
-    vec3(0.664915, 0.198075, 0.488836),
-    vec3(0.671349, 0.200133, 0.487358),
-    vec3(0.677786, 0.202203, 0.485819),
-    vec3(0.684224, 0.204286, 0.484219),
-    vec3(0.690661, 0.206384, 0.482558),
-    vec3(0.697098, 0.208501, 0.480835),
-    vec3(0.703532, 0.210638, 0.479049),
-    vec3(0.709962, 0.212797, 0.477201),
-    vec3(0.716387, 0.214982, 0.475290),
-    vec3(0.722805, 0.217194, 0.473316),
-    vec3(0.729216, 0.219437, 0.471279),
-    vec3(0.735616, 0.221713, 0.469180),
-    vec3(0.742004, 0.224025, 0.467018),
-    vec3(0.748378, 0.226377, 0.464794),
-    vec3(0.754737, 0.228772, 0.462509),
-    vec3(0.761077, 0.231214, 0.460162),
-    vec3(0.767398, 0.233705, 0.457755),
-    vec3(0.773695, 0.236249, 0.455289),
-    vec3(0.779968, 0.238851, 0.452765),
-    vec3(0.786212, 0.241514, 0.450184),
-    vec3(0.792427, 0.244242, 0.447543),
-    vec3(0.798608, 0.247040, 0.444848),
-    vec3(0.804752, 0.249911, 0.442102),
-    vec3(0.810855, 0.252861, 0.439305),
-    vec3(0.816914, 0.255895, 0.436461),
-    vec3(0.822926, 0.259016, 0.433573),
-    vec3(0.828886, 0.262229, 0.430644),
-    vec3(0.834791, 0.265540, 0.427671),
-    vec3(0.840636, 0.268953, 0.424666),
-    vec3(0.846416, 0.272473, 0.421631),
-    vec3(0.852126, 0.276106, 0.418573),
-    vec3(0.857763, 0.279857, 0.415496),
-    vec3(0.863320, 0.283729, 0.412403),
-    vec3(0.868793, 0.287728, 0.409303),
-    vec3(0.874176, 0.291859, 0.406205),
-    vec3(0.879464, 0.296125, 0.403118),
-    vec3(0.884651, 0.300530, 0.400047),
-    vec3(0.889731, 0.305079, 0.397002),
-    vec3(0.894700, 0.309773, 0.393995),
-    vec3(0.899552, 0.314616, 0.391037),
-    vec3(0.904281, 0.319610, 0.388137),
-    vec3(0.908884, 0.324755, 0.385308),
-    vec3(0.913354, 0.330052, 0.382563),
-    vec3(0.917689, 0.335500, 0.379915),
-    vec3(0.921884, 0.341098, 0.377376),
-    vec3(0.925937, 0.346844, 0.374959),
-    vec3(0.929845, 0.352734, 0.372677),
-    vec3(0.933606, 0.358764, 0.370541),
-    vec3(0.937221, 0.364929, 0.368567),
-    vec3(0.940687, 0.371224, 0.366762),
-    vec3(0.944006, 0.377643, 0.365136),
-    vec3(0.947180, 0.384178, 0.363701),
-    vec3(0.950210, 0.390820, 0.362468),
-    vec3(0.953099, 0.397563, 0.361438),
-    vec3(0.955849, 0.404400, 0.360619),
-    vec3(0.958464, 0.411324, 0.360014),
-    vec3(0.960949, 0.418323, 0.359630),
-    vec3(0.963310, 0.425390, 0.359469),
-    vec3(0.965549, 0.432519, 0.359529),
-    vec3(0.967671, 0.439703, 0.359810),
-    vec3(0.969680, 0.446936, 0.360311),
-    vec3(0.971582, 0.454210, 0.361030),
-    vec3(0.973381, 0.461520, 0.361965),
-    vec3(0.975082, 0.468861, 0.363111),
-    vec3(0.976690, 0.476226, 0.364466),
-    vec3(0.978210, 0.483612, 0.366025),
-    vec3(0.979645, 0.491014, 0.367783),
-    vec3(0.981000, 0.498428, 0.369734),
-    vec3(0.982279, 0.505851, 0.371874),
-    vec3(0.983485, 0.513280, 0.374198),
-    vec3(0.984622, 0.520713, 0.376698),
-    vec3(0.985693, 0.528148, 0.379371),
-    vec3(0.986700, 0.535582, 0.382210),
-    vec3(0.987646, 0.543015, 0.385210),
-    vec3(0.988533, 0.550446, 0.388365),
-    vec3(0.989363, 0.557873, 0.391671),
-    vec3(0.990138, 0.565296, 0.395122),
-    vec3(0.990871, 0.572706, 0.398714),
-    vec3(0.991558, 0.580107, 0.402441),
-    vec3(0.992196, 0.587502, 0.406299),
-    vec3(0.992785, 0.594891, 0.410283),
-    vec3(0.993326, 0.602275, 0.414390),
-    vec3(0.993834, 0.609644, 0.418613),
-    vec3(0.994309, 0.616999, 0.422950),
-    vec3(0.994738, 0.624350, 0.427397),
-    vec3(0.995122, 0.631696, 0.431951),
-    vec3(0.995480, 0.639027, 0.436607),
-    vec3(0.995810, 0.646344, 0.441361),
-    vec3(0.996096, 0.653659, 0.446213),
-    vec3(0.996341, 0.660969, 0.451160),
-    vec3(0.996580, 0.668256, 0.456192),
-    vec3(0.996775, 0.675541, 0.461314),
-    vec3(0.996925, 0.682828, 0.466526),
-    vec3(0.997077, 0.690088, 0.471811),
-    vec3(0.997186, 0.697349, 0.477182),
-    vec3(0.997254, 0.704611, 0.482635),
-    vec3(0.997325, 0.711848, 0.488154),
-    vec3(0.997351, 0.719089, 0.493755),
-    vec3(0.997351, 0.726324, 0.499428),
-    vec3(0.997341, 0.733545, 0.505167),
-    vec3(0.997285, 0.740772, 0.510983),
-    vec3(0.997228, 0.747981, 0.516859),
-    vec3(0.997138, 0.755190, 0.522806),
-    vec3(0.997019, 0.762398, 0.528821),
-    vec3(0.996898, 0.769591, 0.534892),
-    vec3(0.996727, 0.776795, 0.541039),
-    vec3(0.996571, 0.783977, 0.547233),
-    vec3(0.996369, 0.791167, 0.553499),
-    vec3(0.996162, 0.798348, 0.559820),
-    vec3(0.995932, 0.805527, 0.566202),
-    vec3(0.995680, 0.812706, 0.572645),
-    vec3(0.995424, 0.819875, 0.579140),
-    vec3(0.995131, 0.827052, 0.585701),
-    vec3(0.994851, 0.834213, 0.592307),
-    vec3(0.994524, 0.841387, 0.598983),
-    vec3(0.994222, 0.848540, 0.605696),
-    vec3(0.993866, 0.855711, 0.612482),
-    vec3(0.993545, 0.862859, 0.619299),
-    vec3(0.993170, 0.870024, 0.626189),
-    vec3(0.992831, 0.877168, 0.633109),
-    vec3(0.992440, 0.884330, 0.640099),
-    vec3(0.992089, 0.891470, 0.647116),
-    vec3(0.991688, 0.898627, 0.654202),
-    vec3(0.991332, 0.905763, 0.661309),
-    vec3(0.990930, 0.912915, 0.668481),
-    vec3(0.990570, 0.920049, 0.675675),
-    vec3(0.990175, 0.927196, 0.682926),
-    vec3(0.989815, 0.934329, 0.690198),
-    vec3(0.989434, 0.941470, 0.697519),
-    vec3(0.989077, 0.948604, 0.704863),
-    vec3(0.988717, 0.955742, 0.712242),
-    vec3(0.988367, 0.962878, 0.719649),
-    vec3(0.988033, 0.970012, 0.727077),
-    vec3(0.987691, 0.977154, 0.734536),
-    vec3(0.987387, 0.984288, 0.742002),
-    vec3(0.987053, 0.991438, 0.749504)
-);
-
-const vec3 GIST_EARTH_COLORS[GIST_EARTH_STOPS] = vec3[](
-    vec3(0.000000, 0.000000, 0.000000),
-    vec3(0.002613, 0.000000, 0.168692),
-    vec3(0.005227, 0.000000, 0.221664),
-    vec3(0.007840, 0.000000, 0.263805),
-    vec3(0.010454, 0.000000, 0.305947),
-    vec3(0.013067, 0.000000, 0.348089),
-    vec3(0.015681, 0.000000, 0.390231),
-    vec3(0.018294, 0.000000, 0.432373),
-    vec3(0.020908, 0.008907, 0.454745),
-    vec3(0.023521, 0.017927, 0.455606),
-    vec3(0.026135, 0.026948, 0.456317),
-    vec3(0.028748, 0.035968, 0.457028),
-    vec3(0.031361, 0.044988, 0.457739),
-    vec3(0.033975, 0.054008, 0.458449),
-    vec3(0.036588, 0.063028, 0.459160),
-    vec3(0.039202, 0.072048, 0.459871),
-    vec3(0.041815, 0.081068, 0.460582),
-    vec3(0.044429, 0.090088, 0.461293),
-    vec3(0.047042, 0.099108, 0.462004),
-    vec3(0.049656, 0.108128, 0.462715),
-    vec3(0.052269, 0.117148, 0.463426),
-    vec3(0.054883, 0.126168, 0.464136),
-    vec3(0.057496, 0.135189, 0.464847),
-    vec3(0.060109, 0.144209, 0.465558),
-    vec3(0.062723, 0.153229, 0.466269),
-    vec3(0.065336, 0.162249, 0.466980),
-    vec3(0.067950, 0.171269, 0.467691),
-    vec3(0.070563, 0.180289, 0.468402),
-    vec3(0.073177, 0.189308, 0.469113),
-    vec3(0.075790, 0.197466, 0.469824),
-    vec3(0.078404, 0.205623, 0.470534),
-    vec3(0.081017, 0.213780, 0.471245),
-    vec3(0.083631, 0.221938, 0.471956),
-    vec3(0.086244, 0.230095, 0.472667),
-    vec3(0.088857, 0.238253, 0.473378),
-    vec3(0.091471, 0.246410, 0.474089),
-    vec3(0.094084, 0.254568, 0.474800),
-    vec3(0.096698, 0.262725, 0.475511),
-    vec3(0.099311, 0.270882, 0.476221),
-    vec3(0.101925, 0.279040, 0.476932),
-    vec3(0.104538, 0.287197, 0.477643),
-    vec3(0.107152, 0.295355, 0.478354),
-    vec3(0.109765, 0.303511, 0.479065),
-    vec3(0.112378, 0.310845, 0.479776),
-    vec3(0.114992, 0.318178, 0.480487),
-    vec3(0.117605, 0.325512, 0.481198),
-    vec3(0.120219, 0.332845, 0.481909),
-    vec3(0.122832, 0.340179, 0.482619),
-    vec3(0.125446, 0.347513, 0.483330),
-    vec3(0.128059, 0.354846, 0.484041),
-    vec3(0.130673, 0.362180, 0.484752),
-    vec3(0.133286, 0.369513, 0.485463),
-    vec3(0.135900, 0.376847, 0.486174),
-    vec3(0.138513, 0.384168, 0.486885),
-    vec3(0.141126, 0.390366, 0.487596),
-    vec3(0.143740, 0.396564, 0.488306),
-    vec3(0.146353, 0.402761, 0.489017),
-    vec3(0.148967, 0.408959, 0.489728),
-    vec3(0.151580, 0.415157, 0.490439),
-    vec3(0.154194, 0.421355, 0.491150),
-    vec3(0.156807, 0.427552, 0.491861),
-    vec3(0.159421, 0.433750, 0.492572),
-    vec3(0.162034, 0.439948, 0.493283),
-    vec3(0.164648, 0.446146, 0.493994),
-    vec3(0.167261, 0.452344, 0.494704),
-    vec3(0.169874, 0.458541, 0.495415),
-    vec3(0.172488, 0.464739, 0.496126),
-    vec3(0.175101, 0.470937, 0.496837),
-    vec3(0.177715, 0.477135, 0.497548),
-    vec3(0.180328, 0.483332, 0.498259),
-    vec3(0.182942, 0.489530, 0.498970),
-    vec3(0.185555, 0.495728, 0.499681),
-    vec3(0.188169, 0.501926, 0.500391),
-    vec3(0.190027, 0.504230, 0.495657),
-    vec3(0.191877, 0.506488, 0.490857),
-    vec3(0.193727, 0.508745, 0.486057),
-    vec3(0.195576, 0.511003, 0.481256),
-    vec3(0.197426, 0.513261, 0.476456),
-    vec3(0.199276, 0.515518, 0.471655),
-    vec3(0.201125, 0.517776, 0.466855),
-    vec3(0.202975, 0.520033, 0.462055),
-    vec3(0.204824, 0.522291, 0.457254),
-    vec3(0.206674, 0.524548, 0.452454),
-    vec3(0.208524, 0.526806, 0.447654),
-    vec3(0.210373, 0.529063, 0.442853),
-    vec3(0.212223, 0.531321, 0.438053),
-    vec3(0.214073, 0.533578, 0.433253),
-    vec3(0.215922, 0.535836, 0.428452),
-    vec3(0.217772, 0.538093, 0.423652),
-    vec3(0.219621, 0.540351, 0.418852),
-    vec3(0.221471, 0.542608, 0.414051),
-    vec3(0.223321, 0.544866, 0.409251),
-    vec3(0.225170, 0.547123, 0.404450),
-    vec3(0.227020, 0.549381, 0.399650),
-    vec3(0.228870, 0.551638, 0.394850),
-    vec3(0.230719, 0.553896, 0.390049),
-    vec3(0.232569, 0.556154, 0.385249),
-    vec3(0.234419, 0.558411, 0.380449),
-    vec3(0.236268, 0.560669, 0.375648),
-    vec3(0.238118, 0.562926, 0.370848),
-    vec3(0.239967, 0.565184, 0.366048),
-    vec3(0.241817, 0.567441, 0.361247),
-    vec3(0.243667, 0.569699, 0.356447),
-    vec3(0.245516, 0.571956, 0.351647),
-    vec3(0.247366, 0.574214, 0.346846),
-    vec3(0.249216, 0.576471, 0.342046),
-    vec3(0.251065, 0.578729, 0.337245),
-    vec3(0.252915, 0.580986, 0.332445),
-    vec3(0.254764, 0.583244, 0.327645),
-    vec3(0.256614, 0.585501, 0.322844),
-    vec3(0.258464, 0.587759, 0.318044),
-    vec3(0.260313, 0.590016, 0.313244),
-    vec3(0.262163, 0.592274, 0.308443),
-    vec3(0.264013, 0.594531, 0.303643),
-    vec3(0.265862, 0.596789, 0.298843),
-    vec3(0.267712, 0.599046, 0.294042),
-    vec3(0.269561, 0.601304, 0.289242),
-    vec3(0.271452, 0.603562, 0.284442),
-    vec3(0.280169, 0.605819, 0.279641),
-    vec3(0.288886, 0.608077, 0.274841),
-    vec3(0.297603, 0.610334, 0.277066),
-    vec3(0.306320, 0.612592, 0.279352),
-    vec3(0.315037, 0.614849, 0.281638),
-    vec3(0.323754, 0.617107, 0.283924),
-    vec3(0.332471, 0.619364, 0.286210),
-    vec3(0.341188, 0.621622, 0.288496),
-    vec3(0.349905, 0.623879, 0.290782),
-    vec3(0.358622, 0.626137, 0.293068),
-    vec3(0.367339, 0.628394, 0.295354),
-    vec3(0.376056, 0.630652, 0.297640),
-    vec3(0.384773, 0.632909, 0.299926),
-    vec3(0.393490, 0.635167, 0.302212),
-    vec3(0.402207, 0.637424, 0.304497),
-    vec3(0.410924, 0.639682, 0.306783),
-    vec3(0.419642, 0.641407, 0.309069),
-    vec3(0.428359, 0.643128, 0.311355),
-    vec3(0.437076, 0.644848, 0.313641),
-    vec3(0.445793, 0.646569, 0.315927),
-    vec3(0.454510, 0.648290, 0.318213),
-    vec3(0.463227, 0.650010, 0.320499),
-    vec3(0.471932, 0.651731, 0.321739),
-    vec3(0.478399, 0.653452, 0.322978),
-    vec3(0.484866, 0.655172, 0.324218),
-    vec3(0.491332, 0.656893, 0.325457),
-    vec3(0.497799, 0.658614, 0.326697),
-    vec3(0.504266, 0.660334, 0.327936),
-    vec3(0.510732, 0.662055, 0.329175),
-    vec3(0.517199, 0.663776, 0.330415),
-    vec3(0.523665, 0.665497, 0.331654),
-    vec3(0.530132, 0.667217, 0.332894),
-    vec3(0.536599, 0.668938, 0.334133),
-    vec3(0.543065, 0.670659, 0.335372),
-    vec3(0.549532, 0.672379, 0.336612),
-    vec3(0.555999, 0.674100, 0.337851),
-    vec3(0.562465, 0.675821, 0.339091),
-    vec3(0.568932, 0.677541, 0.340330),
-    vec3(0.575399, 0.679262, 0.341570),
-    vec3(0.581865, 0.680983, 0.342809),
-    vec3(0.588332, 0.682703, 0.344048),
-    vec3(0.594798, 0.684424, 0.345288),
-    vec3(0.601265, 0.686145, 0.346527),
-    vec3(0.607732, 0.687866, 0.347767),
-    vec3(0.614198, 0.689586, 0.349006),
-    vec3(0.620665, 0.691307, 0.350246),
-    vec3(0.627132, 0.693028, 0.351485),
-    vec3(0.633598, 0.694748, 0.352724),
-    vec3(0.640065, 0.696469, 0.353964),
-    vec3(0.646532, 0.698190, 0.355203),
-    vec3(0.652998, 0.699910, 0.356443),
-    vec3(0.659465, 0.701631, 0.357682),
-    vec3(0.665932, 0.703352, 0.358922),
-    vec3(0.672398, 0.705072, 0.360161),
-    vec3(0.678865, 0.706793, 0.361400),
-    vec3(0.685331, 0.708514, 0.362640),
-    vec3(0.691798, 0.710234, 0.363879),
-    vec3(0.698265, 0.711955, 0.365119),
-    vec3(0.704731, 0.713676, 0.366358),
-    vec3(0.711198, 0.715397, 0.367598),
-    vec3(0.717616, 0.717066, 0.368837),
-    vec3(0.719255, 0.713679, 0.370076),
-    vec3(0.720895, 0.710293, 0.371316),
-    vec3(0.722534, 0.706906, 0.372555),
-    vec3(0.724173, 0.703519, 0.373795),
-    vec3(0.725812, 0.700132, 0.375034),
-    vec3(0.727451, 0.696745, 0.376274),
-    vec3(0.729090, 0.693358, 0.377513),
-    vec3(0.730729, 0.689972, 0.378752),
-    vec3(0.732368, 0.686585, 0.379992),
-    vec3(0.734007, 0.683198, 0.381231),
-    vec3(0.735646, 0.679811, 0.382471),
-    vec3(0.737285, 0.676424, 0.383710),
-    vec3(0.738924, 0.673038, 0.384950),
-    vec3(0.740563, 0.669651, 0.386189),
-    vec3(0.742202, 0.666264, 0.387428),
-    vec3(0.743841, 0.662877, 0.388668),
-    vec3(0.745480, 0.659490, 0.389907),
-    vec3(0.747119, 0.656104, 0.391147),
-    vec3(0.748759, 0.652717, 0.392386),
-    vec3(0.750398, 0.649330, 0.393625),
-    vec3(0.752037, 0.645943, 0.394865),
-    vec3(0.753676, 0.642556, 0.396134),
-    vec3(0.755339, 0.639219, 0.405741),
-    vec3(0.759726, 0.641277, 0.415349),
-    vec3(0.764112, 0.642991, 0.424956),
-    vec3(0.768498, 0.644700, 0.434564),
-    vec3(0.772885, 0.646409, 0.444171),
-    vec3(0.777271, 0.648137, 0.453779),
-    vec3(0.781657, 0.651513, 0.463386),
-    vec3(0.786044, 0.654888, 0.472994),
-    vec3(0.790430, 0.658287, 0.482601),
-    vec3(0.794816, 0.661685, 0.492208),
-    vec3(0.799203, 0.665084, 0.501816),
-    vec3(0.803589, 0.668483, 0.511423),
-    vec3(0.807975, 0.671882, 0.521031),
-    vec3(0.812361, 0.675280, 0.530638),
-    vec3(0.816748, 0.678679, 0.540246),
-    vec3(0.821134, 0.682078, 0.549853),
-    vec3(0.825520, 0.685476, 0.559461),
-    vec3(0.829907, 0.688875, 0.569068),
-    vec3(0.834293, 0.692274, 0.578676),
-    vec3(0.838679, 0.695672, 0.588283),
-    vec3(0.843066, 0.699071, 0.597891),
-    vec3(0.847452, 0.704683, 0.607498),
-    vec3(0.851838, 0.710314, 0.617106),
-    vec3(0.856225, 0.715923, 0.626713),
-    vec3(0.860611, 0.721533, 0.636321),
-    vec3(0.864997, 0.726915, 0.645928),
-    vec3(0.869383, 0.732295, 0.655536),
-    vec3(0.873770, 0.737674, 0.665153),
-    vec3(0.878156, 0.743077, 0.676973),
-    vec3(0.882542, 0.750747, 0.688794),
-    vec3(0.886929, 0.758418, 0.700614),
-    vec3(0.891315, 0.766089, 0.712434),
-    vec3(0.895701, 0.773759, 0.724254),
-    vec3(0.900088, 0.781430, 0.736075),
-    vec3(0.904474, 0.789101, 0.747895),
-    vec3(0.908860, 0.796771, 0.759715),
-    vec3(0.913246, 0.804442, 0.771535),
-    vec3(0.917633, 0.812113, 0.783356),
-    vec3(0.922019, 0.819783, 0.795176),
-    vec3(0.926405, 0.827454, 0.806996),
-    vec3(0.930792, 0.836438, 0.818816),
-    vec3(0.935178, 0.845430, 0.830637),
-    vec3(0.939564, 0.854422, 0.842457),
-    vec3(0.943951, 0.863415, 0.854277),
-    vec3(0.948337, 0.872514, 0.866097),
-    vec3(0.952723, 0.881617, 0.877918),
-    vec3(0.957110, 0.893070, 0.889738),
-    vec3(0.961496, 0.904522, 0.901558),
-    vec3(0.965882, 0.915975, 0.913378),
-    vec3(0.970268, 0.927427, 0.925199),
-    vec3(0.974655, 0.938880, 0.937019),
-    vec3(0.979041, 0.950332, 0.948839),
-    vec3(0.983427, 0.961785, 0.960659),
-    vec3(0.987814, 0.973237, 0.972480),
-    vec3(0.992200, 0.984300, 0.984300)
-);
-
-const vec3 TERRAIN_COLORS[TERRAIN_STOPS] = vec3[](
-    vec3(0.200000, 0.200000, 0.600000),
-    vec3(0.194771, 0.210458, 0.610458),
-    vec3(0.189542, 0.220915, 0.620915),
-    vec3(0.184314, 0.231373, 0.631373),
-    vec3(0.179085, 0.241830, 0.641830),
-    vec3(0.173856, 0.252288, 0.652288),
-    vec3(0.168627, 0.262745, 0.662745),
-    vec3(0.163399, 0.273203, 0.673203),
-    vec3(0.158170, 0.283660, 0.683660),
-    vec3(0.152941, 0.294118, 0.694118),
-    vec3(0.147712, 0.304575, 0.704575),
-    vec3(0.142484, 0.315033, 0.715033),
-    vec3(0.137255, 0.325490, 0.725490),
-    vec3(0.132026, 0.335948, 0.735948),
-    vec3(0.126797, 0.346405, 0.746405),
-    vec3(0.121569, 0.356863, 0.756863),
-    vec3(0.116340, 0.367320, 0.767320),
-    vec3(0.111111, 0.377778, 0.777778),
-    vec3(0.105882, 0.388235, 0.788235),
-    vec3(0.100654, 0.398693, 0.798693),
-    vec3(0.095425, 0.409150, 0.809150),
-    vec3(0.090196, 0.419608, 0.819608),
-    vec3(0.084967, 0.430065, 0.830065),
-    vec3(0.079739, 0.440523, 0.840523),
-    vec3(0.074510, 0.450980, 0.850980),
-    vec3(0.069281, 0.461438, 0.861438),
-    vec3(0.064052, 0.471895, 0.871895),
-    vec3(0.058824, 0.482353, 0.882353),
-    vec3(0.053595, 0.492810, 0.892810),
-    vec3(0.048366, 0.503268, 0.903268),
-    vec3(0.043137, 0.513725, 0.913725),
-    vec3(0.037908, 0.524183, 0.924183),
-    vec3(0.032680, 0.534641, 0.934641),
-    vec3(0.027451, 0.545098, 0.945098),
-    vec3(0.022222, 0.555556, 0.955556),
-    vec3(0.016993, 0.566013, 0.966013),
-    vec3(0.011765, 0.576471, 0.976471),
-    vec3(0.006536, 0.586928, 0.986928),
-    vec3(0.001307, 0.597386, 0.997386),
-    vec3(0.000000, 0.605882, 0.982353),
-    vec3(0.000000, 0.613725, 0.958824),
-    vec3(0.000000, 0.621569, 0.935294),
-    vec3(0.000000, 0.629412, 0.911765),
-    vec3(0.000000, 0.637255, 0.888235),
-    vec3(0.000000, 0.645098, 0.864706),
-    vec3(0.000000, 0.652941, 0.841176),
-    vec3(0.000000, 0.660784, 0.817647),
-    vec3(0.000000, 0.668627, 0.794118),
-    vec3(0.000000, 0.676471, 0.770588),
-    vec3(0.000000, 0.684314, 0.747059),
-    vec3(0.000000, 0.692157, 0.723529),
-    vec3(0.000000, 0.700000, 0.700000),
-    vec3(0.000000, 0.707843, 0.676471),
-    vec3(0.000000, 0.715686, 0.652941),
-    vec3(0.000000, 0.723529, 0.629412),
-    vec3(0.000000, 0.731373, 0.605882),
-    vec3(0.000000, 0.739216, 0.582353),
-    vec3(0.000000, 0.747059, 0.558824),
-    vec3(0.000000, 0.754902, 0.535294),
-    vec3(0.000000, 0.762745, 0.511765),
-    vec3(0.000000, 0.770588, 0.488235),
-    vec3(0.000000, 0.778431, 0.464706),
-    vec3(0.000000, 0.786275, 0.441176),
-    vec3(0.000000, 0.794118, 0.417647),
-    vec3(0.003922, 0.800784, 0.400784),
-    vec3(0.019608, 0.803922, 0.403922),
-    vec3(0.035294, 0.807059, 0.407059),
-    vec3(0.050980, 0.810196, 0.410196),
-    vec3(0.066667, 0.813333, 0.413333),
-    vec3(0.082353, 0.816471, 0.416471),
-    vec3(0.098039, 0.819608, 0.419608),
-    vec3(0.113725, 0.822745, 0.422745),
-    vec3(0.129412, 0.825882, 0.425882),
-    vec3(0.145098, 0.829020, 0.429020),
-    vec3(0.160784, 0.832157, 0.432157),
-    vec3(0.176471, 0.835294, 0.435294),
-    vec3(0.192157, 0.838431, 0.438431),
-    vec3(0.207843, 0.841569, 0.441569),
-    vec3(0.223529, 0.844706, 0.444706),
-    vec3(0.239216, 0.847843, 0.447843),
-    vec3(0.254902, 0.850980, 0.450980),
-    vec3(0.270588, 0.854118, 0.454118),
-    vec3(0.286275, 0.857255, 0.457255),
-    vec3(0.301961, 0.860392, 0.460392),
-    vec3(0.317647, 0.863529, 0.463529),
-    vec3(0.333333, 0.866667, 0.466667),
-    vec3(0.349020, 0.869804, 0.469804),
-    vec3(0.364706, 0.872941, 0.472941),
-    vec3(0.380392, 0.876078, 0.476078),
-    vec3(0.396078, 0.879216, 0.479216),
-    vec3(0.411765, 0.882353, 0.482353),
-    vec3(0.427451, 0.885490, 0.485490),
-    vec3(0.443137, 0.888627, 0.488627),
-    vec3(0.458824, 0.891765, 0.491765),
-    vec3(0.474510, 0.894902, 0.494902),
-    vec3(0.490196, 0.898039, 0.498039),
-    vec3(0.505882, 0.901176, 0.501176),
-    vec3(0.521569, 0.904314, 0.504314),
-    vec3(0.537255, 0.907451, 0.507451),
-    vec3(0.552941, 0.910588, 0.510588),
-    vec3(0.568627, 0.913725, 0.513725),
-    vec3(0.584314, 0.916863, 0.516863),
-    vec3(0.600000, 0.920000, 0.520000),
-    vec3(0.615686, 0.923137, 0.523137),
-    vec3(0.631373, 0.926275, 0.526275),
-    vec3(0.647059, 0.929412, 0.529412),
-    vec3(0.662745, 0.932549, 0.532549),
-    vec3(0.678431, 0.935686, 0.535686),
-    vec3(0.694118, 0.938824, 0.538824),
-    vec3(0.709804, 0.941961, 0.541961),
-    vec3(0.725490, 0.945098, 0.545098),
-    vec3(0.741176, 0.948235, 0.548235),
-    vec3(0.756863, 0.951373, 0.551373),
-    vec3(0.772549, 0.954510, 0.554510),
-    vec3(0.788235, 0.957647, 0.557647),
-    vec3(0.803922, 0.960784, 0.560784),
-    vec3(0.819608, 0.963922, 0.563922),
-    vec3(0.835294, 0.967059, 0.567059),
-    vec3(0.850980, 0.970196, 0.570196),
-    vec3(0.866667, 0.973333, 0.573333),
-    vec3(0.882353, 0.976471, 0.576471),
-    vec3(0.898039, 0.979608, 0.579608),
-    vec3(0.913725, 0.982745, 0.582745),
-    vec3(0.929412, 0.985882, 0.585882),
-    vec3(0.945098, 0.989020, 0.589020),
-    vec3(0.960784, 0.992157, 0.592157),
-    vec3(0.976471, 0.995294, 0.595294),
-    vec3(0.992157, 0.998431, 0.598431),
-    vec3(0.996078, 0.994980, 0.597882),
-    vec3(0.988235, 0.984941, 0.593647),
-    vec3(0.980392, 0.974902, 0.589412),
-    vec3(0.972549, 0.964863, 0.585176),
-    vec3(0.964706, 0.954824, 0.580941),
-    vec3(0.956863, 0.944784, 0.576706),
-    vec3(0.949020, 0.934745, 0.572471),
-    vec3(0.941176, 0.924706, 0.568235),
-    vec3(0.933333, 0.914667, 0.564000),
-    vec3(0.925490, 0.904627, 0.559765),
-    vec3(0.917647, 0.894588, 0.555529),
-    vec3(0.909804, 0.884549, 0.551294),
-    vec3(0.901961, 0.874510, 0.547059),
-    vec3(0.894118, 0.864471, 0.542824),
-    vec3(0.886275, 0.854431, 0.538588),
-    vec3(0.878431, 0.844392, 0.534353),
-    vec3(0.870588, 0.834353, 0.530118),
-    vec3(0.862745, 0.824314, 0.525882),
-    vec3(0.854902, 0.814275, 0.521647),
-    vec3(0.847059, 0.804235, 0.517412),
-    vec3(0.839216, 0.794196, 0.513176),
-    vec3(0.831373, 0.784157, 0.508941),
-    vec3(0.823529, 0.774118, 0.504706),
-    vec3(0.815686, 0.764078, 0.500471),
-    vec3(0.807843, 0.754039, 0.496235),
-    vec3(0.800000, 0.744000, 0.492000),
-    vec3(0.792157, 0.733961, 0.487765),
-    vec3(0.784314, 0.723922, 0.483529),
-    vec3(0.776471, 0.713882, 0.479294),
-    vec3(0.768627, 0.703843, 0.475059),
-    vec3(0.760784, 0.693804, 0.470824),
-    vec3(0.752941, 0.683765, 0.466588),
-    vec3(0.745098, 0.673725, 0.462353),
-    vec3(0.737255, 0.663686, 0.458118),
-    vec3(0.729412, 0.653647, 0.453882),
-    vec3(0.721569, 0.643608, 0.449647),
-    vec3(0.713725, 0.633569, 0.445412),
-    vec3(0.705882, 0.623529, 0.441176),
-    vec3(0.698039, 0.613490, 0.436941),
-    vec3(0.690196, 0.603451, 0.432706),
-    vec3(0.682353, 0.593412, 0.428471),
-    vec3(0.674510, 0.583373, 0.424235),
-    vec3(0.666667, 0.573333, 0.420000),
-    vec3(0.658824, 0.563294, 0.415765),
-    vec3(0.650980, 0.553255, 0.411529),
-    vec3(0.643137, 0.543216, 0.407294),
-    vec3(0.635294, 0.533176, 0.403059),
-    vec3(0.627451, 0.523137, 0.398824),
-    vec3(0.619608, 0.513098, 0.394588),
-    vec3(0.611765, 0.503059, 0.390353),
-    vec3(0.603922, 0.493020, 0.386118),
-    vec3(0.596078, 0.482980, 0.381882),
-    vec3(0.588235, 0.472941, 0.377647),
-    vec3(0.580392, 0.462902, 0.373412),
-    vec3(0.572549, 0.452863, 0.369176),
-    vec3(0.564706, 0.442824, 0.364941),
-    vec3(0.556863, 0.432784, 0.360706),
-    vec3(0.549020, 0.422745, 0.356471),
-    vec3(0.541176, 0.412706, 0.352235),
-    vec3(0.533333, 0.402667, 0.348000),
-    vec3(0.525490, 0.392627, 0.343765),
-    vec3(0.517647, 0.382588, 0.339529),
-    vec3(0.509804, 0.372549, 0.335294),
-    vec3(0.501961, 0.362510, 0.331059),
-    vec3(0.505882, 0.367529, 0.337882),
-    vec3(0.513725, 0.377569, 0.348392),
-    vec3(0.521569, 0.387608, 0.358902),
-    vec3(0.529412, 0.397647, 0.369412),
-    vec3(0.537255, 0.407686, 0.379922),
-    vec3(0.545098, 0.417725, 0.390431),
-    vec3(0.552941, 0.427765, 0.400941),
-    vec3(0.560784, 0.437804, 0.411451),
-    vec3(0.568627, 0.447843, 0.421961),
-    vec3(0.576471, 0.457882, 0.432471),
-    vec3(0.584314, 0.467922, 0.442980),
-    vec3(0.592157, 0.477961, 0.453490),
-    vec3(0.600000, 0.488000, 0.464000),
-    vec3(0.607843, 0.498039, 0.474510),
-    vec3(0.615686, 0.508078, 0.485020),
-    vec3(0.623529, 0.518118, 0.495529),
-    vec3(0.631373, 0.528157, 0.506039),
-    vec3(0.639216, 0.538196, 0.516549),
-    vec3(0.647059, 0.548235, 0.527059),
-    vec3(0.654902, 0.558275, 0.537569),
-    vec3(0.662745, 0.568314, 0.548078),
-    vec3(0.670588, 0.578353, 0.558588),
-    vec3(0.678431, 0.588392, 0.569098),
-    vec3(0.686275, 0.598431, 0.579608),
-    vec3(0.694118, 0.608471, 0.590118),
-    vec3(0.701961, 0.618510, 0.600627),
-    vec3(0.709804, 0.628549, 0.611137),
-    vec3(0.717647, 0.638588, 0.621647),
-    vec3(0.725490, 0.648627, 0.632157),
-    vec3(0.733333, 0.658667, 0.642667),
-    vec3(0.741176, 0.668706, 0.653176),
-    vec3(0.749020, 0.678745, 0.663686),
-    vec3(0.756863, 0.688784, 0.674196),
-    vec3(0.764706, 0.698824, 0.684706),
-    vec3(0.772549, 0.708863, 0.695216),
-    vec3(0.780392, 0.718902, 0.705725),
-    vec3(0.788235, 0.728941, 0.716235),
-    vec3(0.796078, 0.738980, 0.726745),
-    vec3(0.803922, 0.749020, 0.737255),
-    vec3(0.811765, 0.759059, 0.747765),
-    vec3(0.819608, 0.769098, 0.758275),
-    vec3(0.827451, 0.779137, 0.768784),
-    vec3(0.835294, 0.789176, 0.779294),
-    vec3(0.843137, 0.799216, 0.789804),
-    vec3(0.850980, 0.809255, 0.800314),
-    vec3(0.858824, 0.819294, 0.810824),
-    vec3(0.866667, 0.829333, 0.821333),
-    vec3(0.874510, 0.839373, 0.831843),
-    vec3(0.882353, 0.849412, 0.842353),
-    vec3(0.890196, 0.859451, 0.852863),
-    vec3(0.898039, 0.869490, 0.863373),
-    vec3(0.905882, 0.879529, 0.873882),
-    vec3(0.913725, 0.889569, 0.884392),
-    vec3(0.921569, 0.899608, 0.894902),
-    vec3(0.929412, 0.909647, 0.905412),
-    vec3(0.937255, 0.919686, 0.915922),
-    vec3(0.945098, 0.929725, 0.926431),
-    vec3(0.952941, 0.939765, 0.936941),
-    vec3(0.960784, 0.949804, 0.947451),
-    vec3(0.968627, 0.959843, 0.957961),
-    vec3(0.976471, 0.969882, 0.968471),
-    vec3(0.984314, 0.979922, 0.978980),
-    vec3(0.992157, 0.989961, 0.989490),
-    vec3(1.000000, 1.000000, 1.000000)
-);
-
-vec4 colormapBlueToRed(float v) {
-    return vec4(v, 0.0, 1.0 - v, 1.0);
-}
-
-vec4 colormapGrayscale(float v) {
-    return vec4(v, v, v, 1.0);
-}
-
-vec3 getColorAtIndex(int colormapID, int index) {
-    if (colormapID == 2) {
-        return JET_COLORS[index];
-    } else if (colormapID == 3) {
-        return TURBO_COLORS[index];
-    } else if (colormapID == 4) {
-        return VIRIDIS_COLORS[index];
-    } else if (colormapID == 5) {
-        return PLASMA_COLORS[index];
-    } else if (colormapID == 6) {
-        return INFERNO_COLORS[index];
-    } else if (colormapID == 7) {
-        return MAGMA_COLORS[index];
-    } else if (colormapID == 8) {
-        return GIST_EARTH_COLORS[index];
-    } else if (colormapID == 9) {
-        return TERRAIN_COLORS[index];
-    } else {
-        return vec3(0.0, 0.0, 0.0);
-    }
-}
-
-/*
-* Sample any multi stop colormap. The logic is the following:
-* - Find the "stop" at which the input value falls into. This is done by using the nearest integer less than 'x * segments' (floor)
-* - Interpolate between the colors at the two surrounding stops using the fractional part of 'x * segments' as a lerp factor
-*/
-vec4 sampleColormap(float v, int colormapID, int stops) {
-    int segments = stops - 1;
-    float scaledValue = v * float(segments);
-    float t = fract(scaledValue);
-
-    int index0 = int(clamp(floor(scaledValue), 0.0, float(segments - 1)));
-    int index1 = index0 + 1;
-
-    vec3 color0 = getColorAtIndex(colormapID, index0);
-    vec3 color1 = getColorAtIndex(colormapID, index1);
-
-    vec3 finalColor = mix(color0, color1, t);
-    return vec4(finalColor, 1.0);
-}
+uniform sampler2D uColormapLut; // one colormap per row, filled by Heatmap::buildColormapLut
+uniform float uColormapLutWidth;
+uniform float uColormapRow; // texture coordinate of the center of the selected row
 
 void main()
 {
@@ -1894,27 +16,7 @@ void main()
     float normalizedValue = (range > 0.0) ? (rawValue - uClampMin) / range : 0.0;
     float v = clamp(normalizedValue, 0.0, 1.0);
 
-    if (uColormapID == 0) {
-        gl_FragColor = colormapBlueToRed(v);
-    } else if (uColormapID == 1) {
-        gl_FragColor = colormapGrayscale(v);
-    } else if (uColormapID == 2) { // Jet
-        gl_FragColor = sampleColormap(v, 2, JET_STOPS);
-    } else if (uColormapID == 3) { // Turbo
-        gl_FragColor = sampleColormap(v, 3, TURBO_STOPS);
-    } else if (uColormapID == 4) { // Viridis
-        gl_FragColor = sampleColormap(v, 4, VIRIDIS_STOPS);
-    } else if (uColormapID == 5) { // Plasma
-        gl_FragColor = sampleColormap(v, 5, PLASMA_STOPS);
-    } else if (uColormapID == 6) { // Inferno
-        gl_FragColor = sampleColormap(v, 6, INFERNO_STOPS);
-    } else if (uColormapID == 7) { // Magma
-        gl_FragColor = sampleColormap(v, 7, MAGMA_STOPS);
-    } else if (uColormapID == 8) { // Gist Earth
-        gl_FragColor = sampleColormap(v, 8, GIST_EARTH_STOPS);
-    } else if (uColormapID == 9) { // Terrain
-        gl_FragColor = sampleColormap(v, 9, TERRAIN_STOPS);
-    } else {
-        gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);
-    }
-}
\ No newline at end of file
+    // Map [0, 1] onto the first and last texel centers so the hardware lerp between texels matches the stops
+    float u = (v * (uColormapLutWidth - 1.0) + 0.5) / uColormapLutWidth;
+    gl_FragColor = vec4(texture2D(uColormapLut, vec2(u, uColormapRow)).rgb, 1.0);
+}
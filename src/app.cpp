@@ -86,14 +86,14 @@ void App::render()
     {
         m_heatmap.getHeatmapShader().setUniform("uClampMin", m_heatmap.getCurrentClampMin());
         m_heatmap.getHeatmapShader().setUniform("uClampMax", m_heatmap.getCurrentClampMax());
-        m_window.draw(m_heatmap.getHeatmapSprite(), &m_heatmap.getHeatmapShader());
+        m_heatmap.drawTiles(m_window);
 
         m_geoData.draw(m_heatmap, m_window);
     }
 
 
     m_gridOverlay.draw(m_heatmap, m_window);
-    m_cellTooltip.draw(m_heatmap, m_window);
+    m_cellTooltip.draw(m_heatmap, m_geoData, m_window);
 
     ImGui::SFML::Render(m_window);
     m_window.display();
@@ -1,6 +1,8 @@
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <imgui.h>
+#include <iostream>
 #include <limits>
 
 #include "cellTooltip.hpp"
@@ -10,8 +12,10 @@ namespace bgi = boost::geometry::index;
 
 static const ImVec2 TOOLTIP_OFFSET(14.f, 18.f);
 
-void CellTooltip::draw(Heatmap& heatmap, sf::RenderWindow& window)
+void CellTooltip::draw(Heatmap& heatmap, const GeoData& geoData, sf::RenderWindow& window)
 {
+    drawHoverPick(heatmap, geoData, window);
+
     if (!m_isVisible || !heatmap.getAscData())
     {
         return;
@@ -82,43 +86,7 @@ void CellTooltip::draw(Heatmap& heatmap, sf::RenderWindow& window)
         if (m_geoPickEntity)
         {
             ImGui::Separator();
-            ImGui::TextDisabled("Geo:");
-            ImGui::Text("id: %u", m_geoPickEntity->id);
-            ImGui::Text("name: %s", m_geoPickEntity->name.c_str());
-
-            const char* typeStr = "";
-            switch (m_geoPickEntity->type)
-            {
-                case GeoCsvParser::EntityType::Maximum:
-                    typeStr = "MAXIMUM";
-                    break;
-                case GeoCsvParser::EntityType::Minimum:
-                    typeStr = "MINIMUM";
-                    break;
-                case GeoCsvParser::EntityType::Saddle:
-                    typeStr = "SADDLE";
-                    break;
-                case GeoCsvParser::EntityType::LineAscending:
-                    typeStr = "LINE-ASCENDING";
-                    break;
-                case GeoCsvParser::EntityType::LineDescending:
-                    typeStr = "LINE-DESCENDING";
-                    break;
-                case GeoCsvParser::EntityType::Area:
-                    typeStr = "AREA";
-                    break;
-                default:
-                    typeStr = "UNKNOWN";
-                    break;
-            }
-
-            ImGui::Text("type: %s", typeStr);
-            ImGui::Text("life: %.3f", m_geoPickEntity->life);
-
-            if (!m_geoPickEntity->misc.empty())
-            {
-                ImGui::Text("misc: %s", m_geoPickEntity->misc.c_str());
-            }
+            drawEntityAttributes(*m_geoPickEntity);
         }
     }
 
@@ -171,8 +139,8 @@ void CellTooltip::show(Heatmap& heatmap, sf::RenderWindow& window, const GeoData
     const int   clampedRow = std::clamp(row, 0, nrows - 1);
 
     const std::size_t index    = static_cast<std::size_t>(clampedRow) * ncols + clampedCol;
-    const double      value    = asc->getData()[index];
-    const bool        hasValue = (value != header.nodata_value);
+    const double      value    = asc->getValue(index);
+    const bool        hasValue = !asc->isNoData(index);
 
     m_data.col      = clampedCol;
     m_data.row      = clampedRow;
@@ -189,44 +157,108 @@ void CellTooltip::hide()
     m_geoPickEntity = nullptr;
 }
 
+// Packed trees have full nodes, so their node count follows from the value count. Boost allocates each node with
+// room for one element over the maximum, values in the leaves and box plus child pointer pairs above them
+template <typename TreeT>
+static std::size_t estimateMemoryUsage(const TreeT& tree)
+{
+    const std::size_t fanout   = TreeT::parameters_type::max_elements;
+    const std::size_t leafSize = (fanout + 1) * sizeof(typename TreeT::value_type);
+    const std::size_t nodeSize = (fanout + 1) * (sizeof(typename TreeT::bounds_type) + sizeof(void*));
+
+    std::size_t nodeCount = (tree.size() + fanout - 1) / fanout;
+    std::size_t bytes     = nodeCount * leafSize;
+
+    while (nodeCount > 1)
+    {
+        nodeCount = (nodeCount + fanout - 1) / fanout;
+        bytes += nodeCount * nodeSize;
+    }
+
+    return bytes;
+}
+
+// The range constructor bulk loads the tree with STR packing, which builds much faster than inserting one value at
+// a time and gives fuller, less overlapping nodes
+template <typename TreeT, typename ValueT>
+static TreeT buildPackedTree(std::vector<ValueT>& values, const char* name, CellTooltip::TreeReport& outReport)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    TreeT tree(values.begin(), values.end());
+
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+
+    outReport.name         = name;
+    outReport.valueCount   = tree.size();
+    outReport.milliseconds = elapsed.count();
+    outReport.bytes        = estimateMemoryUsage(tree);
+
+    // The tree keeps its own copy of the values
+    values.clear();
+    values.shrink_to_fit();
+
+    return tree;
+}
+
 void CellTooltip::rebuildSpatialIndex(const Heatmap& heatmap, const GeoData& geoData)
 {
-    m_points       = PointsRTree{};
-    m_lineSegsAsc  = SegmentsRTree{};
-    m_lineSegsDesc = SegmentsRTree{};
-    m_areaSegs     = SegmentsRTree{};
+    // The current trees and the picked entity may point into a dataset that was just replaced
+    hide();
+    m_index.reset();
 
-    if (!geoData.getGeoData() || !heatmap.getAscData())
+    // Tree construction cannot be interrupted, a superseded build is waited for
+    if (m_pendingIndex.valid())
+    {
+        m_pendingIndex.wait();
+        m_pendingIndex = {};
+    }
+
+    if (!geoData.getGeoData() || !heatmap.getAscData() || !geoData.hasLocalCoordinates())
     {
         return;
     }
 
     const std::size_t pointCount = geoData.maximum().size() + geoData.minimum().size() + geoData.saddles().size();
-    const std::size_t lineAscSegmentCount  = geoData.countLineSegmentsAscending();
-    const std::size_t lineDescSegmentCount = geoData.countLineSegmentsDescending();
-    const std::size_t areaSegmentCount     = geoData.countAreaSegments();
+    const std::size_t segmentCount = geoData.countLineSegmentsAscending() + geoData.countLineSegmentsDescending() +
+                                     geoData.countAreaSegments();
 
-    std::vector<PointValue> points;
-    points.reserve(pointCount);
+    std::vector<PickValue> values;
+    values.reserve(pointCount + segmentCount);
 
-    std::vector<SegmentValue> lineSegmentsAscending;
-    lineSegmentsAscending.reserve(lineAscSegmentCount);
+    // Collecting reads GeoData, which the render thread may change at any time, so only the building is deferred
+    collectPoints(heatmap, geoData, values);
+    collectLineSegmentsAscending(heatmap, geoData, values);
+    collectLineSegmentsDescending(heatmap, geoData, values);
+    collectAreaSegments(heatmap, geoData, values);
 
-    std::vector<SegmentValue> lineSegmentsDescending;
-    lineSegmentsDescending.reserve(lineDescSegmentCount);
+    m_pendingIndex = std::async(std::launch::async, &CellTooltip::buildSpatialIndex, std::move(values));
+}
+
+// Runs on a worker thread, owns its input
+std::unique_ptr<CellTooltip::SpatialIndex> CellTooltip::buildSpatialIndex(std::vector<PickValue> values)
+{
+    auto index  = std::make_unique<SpatialIndex>();
+    index->tree = buildPackedTree<PickRTree>(values, "points, lines and areas", index->report);
+
+    return index;
+}
 
-    std::vector<SegmentValue> areaSegments;
-    areaSegments.reserve(areaSegmentCount);
+bool CellTooltip::finishBuildingSpatialIndex()
+{
+    if (!m_pendingIndex.valid() || m_pendingIndex.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
 
-    collectPoints(heatmap, geoData, points);
-    collectLineSegmentsAscending(heatmap, geoData, lineSegmentsAscending);
-    collectLineSegmentsDescending(heatmap, geoData, lineSegmentsDescending);
-    collectAreaSegments(heatmap, geoData, areaSegments);
+    m_index        = m_pendingIndex.get();
+    m_pendingIndex = {};
 
-    m_points       = PointsRTree(points.begin(), points.end());
-    m_lineSegsAsc  = SegmentsRTree(lineSegmentsAscending.begin(), lineSegmentsAscending.end());
-    m_lineSegsDesc = SegmentsRTree(lineSegmentsDescending.begin(), lineSegmentsDescending.end());
-    m_areaSegs     = SegmentsRTree(areaSegments.begin(), areaSegments.end());
+    const TreeReport& report = m_index->report;
+    std::cout << "Pick index of " << report.name << ": " << report.valueCount << " values, built in "
+              << report.milliseconds << " ms, ~" << report.bytes / 1024 << " KiB\n";
+
+    return true;
 }
 
 CellTooltip::BBox CellTooltip::getLocalPickBBox(const sf::Vector2i      mousePixel,
@@ -301,16 +333,13 @@ float CellTooltip::pixelDistanceToSegment(const sf::Vector2i mousePixel,
     return std::sqrt(deltaX * deltaX + deltaY * deltaY);
 }
 
-void CellTooltip::collectPoints(const Heatmap& heatmap, const GeoData& geoData, std::vector<PointValue>& out)
+void CellTooltip::collectPoints(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out)
 {
-    out.clear();
-
     if (!geoData.getGeoData() || !heatmap.getAscData())
     {
         return;
     }
 
-    const auto& header   = heatmap.getAscData()->getHeader();
     const auto& entities = geoData.getGeoData()->getEntities();
 
     for (const auto& entity : entities)
@@ -326,35 +355,37 @@ void CellTooltip::collectPoints(const Heatmap& heatmap, const GeoData& geoData,
             continue;
         }
 
-        const sf::Vector2f localPosition = GeoUtils::wktToLocal(entity.geom.point, header);
+        const sf::Vector2f localPosition = geoData.getLocalPosition(entity);
+        const BPoint       point(localPosition.x, localPosition.y);
 
-        out.emplace_back(BPoint(localPosition.x, localPosition.y), &entity);
+        out.emplace_back(BSegment(point, point), &entity, entity.life, getTypeBit(entity.type));
     }
 }
 
-void CellTooltip::addSegmentsForOpenPath(const std::vector<GeoCsvParser::Point>& points,
-                                         const AscParser::Header&                header,
-                                         const GeoCsvParser::Entity*             owner,
-                                         std::vector<CellTooltip::SegmentValue>& out)
+void CellTooltip::addSegmentsForOpenPath(GeoData::LocalSpan                   points,
+                                         const GeoCsvParser::Entity*          owner,
+                                         std::vector<CellTooltip::PickValue>& out)
 {
     if (points.size() < 2)
     {
         return;
     }
 
+    const double   life    = owner->life;
+    const TypeMask typeBit = getTypeBit(owner->type);
+
     for (size_t i = 0; i + 1 < points.size(); ++i)
     {
-        const sf::Vector2f a = GeoUtils::wktToLocal(points[i], header);
-        const sf::Vector2f b = GeoUtils::wktToLocal(points[i + 1], header);
+        const sf::Vector2f& a = points[i];
+        const sf::Vector2f& b = points[i + 1];
 
-        out.emplace_back(BSegment(BPoint(a.x, a.y), BPoint(b.x, b.y)), owner);
+        out.emplace_back(BSegment(BPoint(a.x, a.y), BPoint(b.x, b.y)), owner, life, typeBit);
     }
 }
 
-void CellTooltip::addSegmentsForClosedRing(const std::vector<GeoCsvParser::Point>& ring,
-                                           const AscParser::Header&                header,
-                                           const GeoCsvParser::Entity*             owner,
-                                           std::vector<CellTooltip::SegmentValue>& out)
+void CellTooltip::addSegmentsForClosedRing(GeoData::LocalSpan                   ring,
+                                           const GeoCsvParser::Entity*          owner,
+                                           std::vector<CellTooltip::PickValue>& out)
 {
     const size_t ringSize = ring.size();
 
@@ -363,27 +394,28 @@ void CellTooltip::addSegmentsForClosedRing(const std::vector<GeoCsvParser::Point
         return;
     }
 
+    const double   life    = owner->life;
+    const TypeMask typeBit = getTypeBit(owner->type);
+
     for (size_t i = 0; i < ringSize; ++i)
     {
-        const size_t       j = (i + 1) % ringSize;
-        const sf::Vector2f a = GeoUtils::wktToLocal(ring[i], header);
-        const sf::Vector2f b = GeoUtils::wktToLocal(ring[j], header);
+        const size_t        j = (i + 1) % ringSize;
+        const sf::Vector2f& a = ring[i];
+        const sf::Vector2f& b = ring[j];
 
-        out.emplace_back(BSegment(BPoint(a.x, a.y), BPoint(b.x, b.y)), owner);
+        out.emplace_back(BSegment(BPoint(a.x, a.y), BPoint(b.x, b.y)), owner, life, typeBit);
     }
 }
 
-void CellTooltip::collectLineSegmentsAscending(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out)
+void CellTooltip::collectLineSegmentsAscending(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out)
 {
-    out.clear();
-
     if (!geoData.getGeoData() || !heatmap.getAscData())
     {
         return;
     }
 
-    const auto& header   = heatmap.getAscData()->getHeader();
-    const auto& entities = geoData.getGeoData()->getEntities();
+    const auto& entities   = geoData.getGeoData()->getEntities();
+    const auto& geometries = geoData.getGeoData()->getGeometryStore();
 
     for (const auto& entity : entities)
     {
@@ -392,24 +424,22 @@ void CellTooltip::collectLineSegmentsAscending(const Heatmap& heatmap, const Geo
             continue;
         }
 
-        for (const auto& lineString : entity.geom.lines)
+        for (const auto& lineString : geometries.getLines(entity.geom))
         {
-            addSegmentsForOpenPath(lineString.points, header, &entity, out);
+            addSegmentsForOpenPath(geoData.getLocalSpan(lineString.points), &entity, out);
         }
     }
 }
 
-void CellTooltip::collectLineSegmentsDescending(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out)
+void CellTooltip::collectLineSegmentsDescending(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out)
 {
-    out.clear();
-
     if (!geoData.getGeoData() || !heatmap.getAscData())
     {
         return;
     }
 
-    const auto& header   = heatmap.getAscData()->getHeader();
-    const auto& entities = geoData.getGeoData()->getEntities();
+    const auto& entities   = geoData.getGeoData()->getEntities();
+    const auto& geometries = geoData.getGeoData()->getGeometryStore();
 
     for (const auto& entity : entities)
     {
@@ -418,24 +448,22 @@ void CellTooltip::collectLineSegmentsDescending(const Heatmap& heatmap, const Ge
             continue;
         }
 
-        for (const auto& lineString : entity.geom.lines)
+        for (const auto& lineString : geometries.getLines(entity.geom))
         {
-            addSegmentsForOpenPath(lineString.points, header, &entity, out);
+            addSegmentsForOpenPath(geoData.getLocalSpan(lineString.points), &entity, out);
         }
     }
 }
 
-void CellTooltip::collectAreaSegments(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out)
+void CellTooltip::collectAreaSegments(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out)
 {
-    out.clear();
-
     if (!geoData.getGeoData() || !heatmap.getAscData())
     {
         return;
     }
 
-    const auto& header   = heatmap.getAscData()->getHeader();
-    const auto& entities = geoData.getGeoData()->getEntities();
+    const auto& entities   = geoData.getGeoData()->getEntities();
+    const auto& geometries = geoData.getGeoData()->getGeometryStore();
 
     for (const auto& entity : entities)
     {
@@ -445,103 +473,156 @@ void CellTooltip::collectAreaSegments(const Heatmap& heatmap, const GeoData& geo
         }
 
         bool anyPolygon = false;
-        for (const auto& polygon : entity.geom.polygons)
+        for (const auto& polygon : geometries.getPolygons(entity.geom))
         {
             anyPolygon = true;
             for (const auto& ring : polygon.rings)
             {
-                addSegmentsForClosedRing(ring.points, header, &entity, out);
+                addSegmentsForClosedRing(geoData.getLocalSpan(ring.points), &entity, out);
             }
         }
         if (!anyPolygon)
         {
             // If multiLineString (?)
-            for (const auto& lineString : entity.geom.lines)
+            for (const auto& lineString : geometries.getLines(entity.geom))
             {
-                addSegmentsForOpenPath(lineString.points, header, &entity, out);
+                addSegmentsForOpenPath(geoData.getLocalSpan(lineString.points), &entity, out);
             }
         }
     }
 }
 
-template <typename TreeT, typename ValueT>
-void CellTooltip::pickFromTree(
-    const TreeT&                 tree,
-    const BBox&                  localBox,
-    const sf::RenderWindow&      window,
-    const Heatmap&               heatmap,
-    const GeoData&               geoData,
-    const sf::Vector2i           mousePixel,
-    const GeoCsvParser::Entity*& bestEntity,
-    float&                       bestDistancePixel) const
+const GeoCsvParser::Entity* CellTooltip::pickEntity(const sf::Vector2i      mousePixel,
+                                                    const sf::RenderWindow& window,
+                                                    const Heatmap&          heatmap,
+                                                    const GeoData&          geoData,
+                                                    float&                  outDistancePixel)
 {
-    std::vector<ValueT> candidates;
-    tree.query(bgi::intersects(localBox), std::back_inserter(candidates));
+    if (!m_index || m_index->tree.empty())
+    {
+        return nullptr;
+    }
 
-    const double lifeMin = geoData.getLifeFilterMin();
-    const double lifeMax = geoData.getLifeFilterMax();
+    const auto mode      = geoData.getDisplayMode();
+    const bool linesMode = (mode == GeoData::DisplayMode::Lines);
+    const bool areasMode = (mode == GeoData::DisplayMode::Areas);
+
+    const bool wantLinesAsc  = linesMode && geoData.getShowLinesAscending();
+    const bool wantLinesDesc = linesMode && geoData.getShowLinesDescending();
+    const bool wantAreas     = areasMode && geoData.getShowAreas();
 
-    for (const auto& value : candidates)
+    TypeMask pointTypes   = 0;
+    TypeMask segmentTypes = 0;
+
+    if (geoData.getShowMaximum())
     {
-        const auto* entity = value.second;
+        pointTypes |= getTypeBit(GeoCsvParser::EntityType::Maximum);
+    }
 
-        if (!entity)
-        {
-            continue;
-        }
+    if (geoData.getShowMinimum())
+    {
+        pointTypes |= getTypeBit(GeoCsvParser::EntityType::Minimum);
+    }
 
-        // Filter by current life range
-        if (entity->life < lifeMin || entity->life > lifeMax)
-        {
-            continue;
-        }
+    if (geoData.getShowSaddles())
+    {
+        pointTypes |= getTypeBit(GeoCsvParser::EntityType::Saddle);
+    }
 
-        float distanceInPixels = 0.f;
+    // Lines and areas never collide since only one mode (lines or areas) is active at a time
+    if (wantLinesAsc)
+    {
+        segmentTypes |= getTypeBit(GeoCsvParser::EntityType::LineAscending);
+    }
 
-        if constexpr (std::is_same_v<ValueT, PointValue>)
-        {
-            bool isEntityVisible = false;
+    if (wantLinesDesc)
+    {
+        segmentTypes |= getTypeBit(GeoCsvParser::EntityType::LineDescending);
+    }
 
-            switch (entity->type)
-            {
-                case GeoCsvParser::EntityType::Maximum:
-                    isEntityVisible = geoData.getShowMaximum();
-                    break;
-                case GeoCsvParser::EntityType::Minimum:
-                    isEntityVisible = geoData.getShowMinimum();
-                    break;
-                case GeoCsvParser::EntityType::Saddle:
-                    isEntityVisible = geoData.getShowSaddles();
-                    break;
-                default:
-                    break;
-            }
+    if (wantAreas)
+    {
+        segmentTypes |= getTypeBit(GeoCsvParser::EntityType::Area);
+    }
 
-            if (!isEntityVisible)
-            {
-                continue;
-            }
+    const TypeMask enabledTypes = pointTypes | segmentTypes;
+    if (enabledTypes == 0)
+    {
+        return nullptr;
+    }
+
+    const double lifeMin = geoData.getLifeFilterMin();
+    const double lifeMax = geoData.getLifeFilterMax();
+
+    // Type and life are checked on the stored values while traversing, hidden entities never become candidates.
+    // Life is compared in double like GeoData's group spans, so picking and drawing agree at the filter bounds
+    auto isPickable = [&](const PickValue& value)
+    {
+        const double life = std::get<2>(value);
+
+        return (std::get<3>(value) & enabledTypes) != 0 && life >= lifeMin && life <= lifeMax;
+    };
 
-            const BPoint&      point      = value.first;
-            const sf::Vector2i pointPixel = localToPixel({point.x(), point.y()}, window, heatmap);
+    const BBox         localBox   = getLocalPickBBox(mousePixel, m_pickRadiusPx, window, heatmap);
+    const sf::Vector2f worldPos   = window.mapPixelToCoords(mousePixel, window.getView());
+    const sf::Vector2f localPos   = heatmap.getHeatmapSprite().getInverseTransform().transformPoint(worldPos);
+    const BPoint       mouseLocal = BPoint(localPos.x, localPos.y);
 
-            distanceInPixels = pixelDistance(mousePixel, pointPixel);
+    // The pick box is a square around the cursor, half its side is the pick radius in local units
+    const float radiusLocal = 0.5f * std::max(localBox.max_corner().x() - localBox.min_corner().x(),
+                                              localBox.max_corner().y() - localBox.min_corner().y());
+
+    // A single traversal in nearest first order, all in local space. Points have priority over segments within the
+    // pick radius, so it only goes past the nearest segment while looking for a point and never past the radius
+    const PickValue* best = nullptr;
+    const PickRTree& tree = m_index->tree;
+
+    const auto predicates =
+        bgi::intersects(localBox) && bgi::satisfies(isPickable) && bgi::nearest(mouseLocal, tree.size());
+
+    for (auto it = tree.qbegin(predicates); it != tree.qend(); ++it)
+    {
+        if (boost::geometry::distance(mouseLocal, std::get<0>(*it)) > radiusLocal)
+        {
+            break;
         }
-        else
+
+        if ((std::get<3>(*it) & pointTypes) != 0)
         {
-            const BSegment&    segment = value.first;
-            const sf::Vector2i aPixel  = localToPixel({segment.first.x(), segment.first.y()}, window, heatmap);
-            const sf::Vector2i bPixel  = localToPixel({segment.second.x(), segment.second.y()}, window, heatmap);
+            best = &*it;
+            break;
+        }
 
-            distanceInPixels = pixelDistanceToSegment(mousePixel, aPixel, bPixel);
+        if (!best)
+        {
+            best = &*it;
         }
 
-        if (distanceInPixels < bestDistancePixel)
+        if (pointTypes == 0)
         {
-            bestEntity        = entity;
-            bestDistancePixel = distanceInPixels;
+            break;
         }
     }
+
+    if (!best)
+    {
+        return nullptr;
+    }
+
+    // Only the winner is converted to pixels, for the exact pick radius test
+    const BSegment&    segment       = std::get<0>(*best);
+    const sf::Vector2i aPixel        = localToPixel({segment.first.x(), segment.first.y()}, window, heatmap);
+    const sf::Vector2i bPixel        = localToPixel({segment.second.x(), segment.second.y()}, window, heatmap);
+    const float        distancePixel = pixelDistanceToSegment(mousePixel, aPixel, bPixel);
+
+    if (distancePixel > m_pickRadiusPx)
+    {
+        return nullptr;
+    }
+
+    outDistancePixel = distancePixel;
+
+    return std::get<1>(*best);
 }
 
 void CellTooltip::performPick(const sf::Vector2i mousePixel, sf::RenderWindow& window, const Heatmap& heatmap, const GeoData& geoData)
@@ -552,68 +633,144 @@ void CellTooltip::performPick(const sf::Vector2i mousePixel, sf::RenderWindow& w
         return;
     }
 
-    const BBox localBox = getLocalPickBBox(mousePixel, m_pickRadiusPx, window, heatmap);
+    float distancePixel = 0.f;
 
-    const bool wantMax    = geoData.getShowMaximum();
-    const bool wantMin    = geoData.getShowMinimum();
-    const bool wantSad    = geoData.getShowSaddles();
-    const bool wantPoints = (wantMax || wantMin || wantSad);
+    m_geoPickEntity  = pickEntity(mousePixel, window, heatmap, geoData, distancePixel);
+    m_geoPickMousePx = mousePixel;
+    m_geoPickDistPx  = distancePixel;
+}
 
-    const auto mode      = geoData.getDisplayMode();
-    const bool linesMode = (mode == GeoData::DisplayMode::Lines);
-    const bool areasMode = (mode == GeoData::DisplayMode::Areas);
+void CellTooltip::drawHoverPick(const Heatmap& heatmap, const GeoData& geoData, const sf::RenderWindow& window)
+{
+    // The click tooltip already shows the picked entity
+    if (!m_isHoverPicking || m_isVisible || !heatmap.getAscData() || !geoData.getGeoData() || !window.hasFocus() ||
+        ImGui::GetIO().WantCaptureMouse)
+    {
+        return;
+    }
 
-    const bool wantLinesAsc  = linesMode && geoData.getShowLinesAscending();
-    const bool wantLinesDesc = linesMode && geoData.getShowLinesDescending();
-    const bool wantAreas     = areasMode && geoData.getShowAreas();
+    const sf::Vector2i mousePixel = sf::Mouse::getPosition(window);
+    const sf::Vector2u windowSize = window.getSize();
 
-    // Find Points
-    if (wantPoints)
+    if (mousePixel.x < 0 || mousePixel.y < 0 || mousePixel.x >= static_cast<int>(windowSize.x) ||
+        mousePixel.y >= static_cast<int>(windowSize.y))
     {
-        float                       bestDistancePoints = std::numeric_limits<float>::infinity();
-        const GeoCsvParser::Entity* bestEntityPoints   = nullptr;
+        return;
+    }
 
-        pickFromTree<PointsRTree, PointValue>(m_points, localBox, window, heatmap, geoData, mousePixel, bestEntityPoints, bestDistancePoints);
+    float                       distancePixel = 0.f;
+    const GeoCsvParser::Entity* entity        = pickEntity(mousePixel, window, heatmap, geoData, distancePixel);
 
-        // Early return if we found a point within the pick radius. It has priority over segments of any type
-        if (bestEntityPoints && bestDistancePoints <= m_pickRadiusPx)
-        {
-            m_geoPickEntity  = bestEntityPoints;
-            m_geoPickMousePx = mousePixel;
-            m_geoPickDistPx  = bestDistancePoints;
+    if (!entity)
+    {
+        return;
+    }
 
-            return;
+    highlightEntity(*entity, heatmap, geoData, window);
+
+    ImGui::BeginTooltip();
+    drawEntityAttributes(*entity);
+    ImGui::EndTooltip();
+}
+
+void CellTooltip::highlightEntity(const GeoCsvParser::Entity& entity,
+                                  const Heatmap&              heatmap,
+                                  const GeoData&              geoData,
+                                  const sf::RenderWindow&     window)
+{
+    ImDrawList* drawList   = ImGui::GetBackgroundDrawList();
+    const ImU32 color      = ImGui::GetColorU32(ImGuiCol_Text);
+    const auto& geometries = geoData.getGeoData()->getGeometryStore();
+
+    auto toScreen = [&](const sf::Vector2f local)
+    {
+        const sf::Vector2i pixel = localToPixel(local, window, heatmap);
+
+        return ImVec2(static_cast<float>(pixel.x), static_cast<float>(pixel.y));
+    };
+
+    auto addPath = [&](GeoData::LocalSpan path, ImDrawFlags flags)
+    {
+        m_highlightPath.clear();
+        for (const sf::Vector2f& point : path)
+        {
+            m_highlightPath.push_back(toScreen(point));
         }
-    }
 
-    // Find lines and areas
-    // Lines and areas lookup never collides since only one mode (lines or areas) is active at a time
-    float                       bestDistance = std::numeric_limits<float>::infinity();
-    const GeoCsvParser::Entity* bestEntity   = nullptr;
+        drawList->AddPolyline(m_highlightPath.data(),
+                              static_cast<int>(m_highlightPath.size()),
+                              color,
+                              flags,
+                              HIGHLIGHT_THICKNESS);
+    };
 
-    if (wantLinesAsc)
+    if (entity.geom.type == GeoCsvParser::GeometryType::Point)
     {
-        pickFromTree<SegmentsRTree, SegmentValue>(m_lineSegsAsc, localBox, window, heatmap, geoData, mousePixel, bestEntity, bestDistance);
+        drawList->AddCircle(toScreen(geoData.getLocalPosition(entity)), m_pickRadiusPx, color, 0, HIGHLIGHT_THICKNESS);
+        return;
     }
 
-    if (wantLinesDesc)
+    for (const auto& polygon : geometries.getPolygons(entity.geom))
     {
-        pickFromTree<SegmentsRTree, SegmentValue>(m_lineSegsDesc, localBox, window, heatmap, geoData, mousePixel, bestEntity, bestDistance);
+        for (const auto& ring : polygon.rings)
+        {
+            addPath(geoData.getLocalSpan(ring.points), ImDrawFlags_Closed);
+        }
     }
 
-    if (wantAreas)
+    for (const auto& lineString : geometries.getLines(entity.geom))
     {
-        pickFromTree<SegmentsRTree, SegmentValue>(m_areaSegs, localBox, window, heatmap, geoData, mousePixel, bestEntity, bestDistance);
+        addPath(geoData.getLocalSpan(lineString.points), ImDrawFlags_None);
     }
+}
+
+void CellTooltip::drawEntityAttributes(const GeoCsvParser::Entity& entity)
+{
+    ImGui::TextDisabled("Geo:");
+    ImGui::Text("id: %u", entity.id);
+    ImGui::Text("name: %s", entity.name.c_str());
 
-    if (bestEntity && bestDistance <= m_pickRadiusPx)
+    const char* typeStr = "";
+    switch (entity.type)
     {
-        m_geoPickEntity  = bestEntity;
-        m_geoPickMousePx = mousePixel;
-        m_geoPickDistPx  = bestDistance;
+        case GeoCsvParser::EntityType::Maximum:
+            typeStr = "MAXIMUM";
+            break;
+        case GeoCsvParser::EntityType::Minimum:
+            typeStr = "MINIMUM";
+            break;
+        case GeoCsvParser::EntityType::Saddle:
+            typeStr = "SADDLE";
+            break;
+        case GeoCsvParser::EntityType::LineAscending:
+            typeStr = "LINE-ASCENDING";
+            break;
+        case GeoCsvParser::EntityType::LineDescending:
+            typeStr = "LINE-DESCENDING";
+            break;
+        case GeoCsvParser::EntityType::Area:
+            typeStr = "AREA";
+            break;
+        default:
+            typeStr = "UNKNOWN";
+            break;
     }
-    else
+
+    ImGui::Text("type: %s", typeStr);
+    ImGui::Text("life: %.3f", entity.life);
+
+    if (!entity.misc.empty())
     {
-        m_geoPickEntity = nullptr;
+        ImGui::Text("misc: %s", entity.misc.c_str());
     }
 }
+
+bool CellTooltip::getHoverPicking() const
+{
+    return m_isHoverPicking;
+}
+
+void CellTooltip::setHoverPicking(bool value)
+{
+    m_isHoverPicking = value;
+}
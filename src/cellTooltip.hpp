@@ -1,7 +1,11 @@
 #ifndef CELL_TOOLTIP_HPP
 #define CELL_TOOLTIP_HPP
 
+#include <cstdint>
+#include <future>
+#include <memory>
 #include <optional>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -22,28 +26,52 @@
 class CellTooltip
 {
 public:
-    void draw(Heatmap& heatmap, sf::RenderWindow& window);
+    void draw(Heatmap& heatmap, const GeoData& geoData, sf::RenderWindow& window);
     void handleMouseWheelScrolled(const sf::Event::MouseWheelScrolled& event);
     void handleMouseButtonPressed(const sf::Event::MouseButtonPressed& event,
                                   Heatmap&                             heatmap,
                                   const GeoData&                       geoData,
                                   sf::RenderWindow&                    window);
 
+    // Collects the pick geometry on the calling thread and bulk loads the trees on a worker thread. Picking finds
+    // nothing until finishBuildingSpatialIndex() publishes the new trees, which must be called from the render thread
     void rebuildSpatialIndex(const Heatmap& heatmap, const GeoData& geoData);
+    bool finishBuildingSpatialIndex();
 
     void show(Heatmap& heatmap, sf::RenderWindow& window, const GeoData& geoData, int screenX, int screenY);
     void hide();
 
+    // Picks the entity under the cursor every frame, highlights it and shows its attributes
+    bool getHoverPicking() const;
+    void setHoverPicking(bool value);
+
     // Boost.Geometry aliases
     using BPoint   = boost::geometry::model::d2::point_xy<float>;
     using BBox     = boost::geometry::model::box<BPoint>;
     using BSegment = boost::geometry::model::segment<BPoint>;
 
-    using PointValue   = std::pair<BPoint, const GeoCsvParser::Entity*>;
-    using SegmentValue = std::pair<BSegment, const GeoCsvParser::Entity*>;
+    // One bit per GeoCsvParser::EntityType, so a single query can select any set of types
+    using TypeMask = uint8_t;
+
+    static constexpr TypeMask getTypeBit(GeoCsvParser::EntityType type)
+    {
+        return static_cast<TypeMask>(1u << static_cast<unsigned>(type));
+    }
 
-    using PointsRTree   = boost::geometry::index::rtree<PointValue, boost::geometry::index::rstar<16>>;
-    using SegmentsRTree = boost::geometry::index::rtree<SegmentValue, boost::geometry::index::rstar<16>>;
+    // Segment (degenerate for points), owner, its life and its type bit. Life and type let queries filter without
+    // touching the entities, so moving the life filter or toggling types never requires a rebuild.
+    // Life is kept as the entity's double so the life filter test matches the one GeoData draws with
+    using PickValue = std::tuple<BSegment, const GeoCsvParser::Entity*, double, TypeMask>;
+    using PickRTree = boost::geometry::index::rtree<PickValue, boost::geometry::index::rstar<16>>;
+
+    // Build statistics of the tree, printed when a rebuilt index is published
+    struct TreeReport
+    {
+        const char* name         = "";
+        std::size_t valueCount   = 0;
+        double      milliseconds = 0.0;
+        std::size_t bytes        = 0; // estimated
+    };
 
 private:
     struct CellData
@@ -63,10 +91,21 @@ private:
 
     float m_pickRadiusPx = 10.f;
 
-    PointsRTree   m_points;
-    SegmentsRTree m_lineSegsAsc;
-    SegmentsRTree m_lineSegsDesc;
-    SegmentsRTree m_areaSegs;
+    static constexpr float HIGHLIGHT_THICKNESS = 2.0f; // pixels
+
+    bool m_isHoverPicking = false;
+
+    std::vector<ImVec2> m_highlightPath; // reused by every highlight
+
+    // Points, lines and areas of the whole dataset in one tree, swapped in as a unit
+    struct SpatialIndex
+    {
+        PickRTree  tree;
+        TreeReport report;
+    };
+
+    std::unique_ptr<SpatialIndex>              m_index;
+    std::future<std::unique_ptr<SpatialIndex>> m_pendingIndex;
 
     BBox getLocalPickBBox(const sf::Vector2i mousePixel, float radiusPixel, const sf::RenderWindow& window, const Heatmap& heatmap);
     float        pixelDistance(sf::Vector2i a, sf::Vector2i b) const;
@@ -74,31 +113,36 @@ private:
     float        pixelDistanceToSegment(sf::Vector2i mousePx, sf::Vector2i Apx, sf::Vector2i Bpx) const;
 
     // Spatial index population methods
-    void collectPoints(const Heatmap& heatmap, const GeoData& geoData, std::vector<PointValue>& out);
-    void collectLineSegmentsAscending(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out);
-    void collectLineSegmentsDescending(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out);
-    void collectAreaSegments(const Heatmap& heatmap, const GeoData& geoData, std::vector<SegmentValue>& out);
-
-    void addSegmentsForOpenPath(const std::vector<GeoCsvParser::Point>& points,
-                                const AscParser::Header&                header,
-                                const GeoCsvParser::Entity*             owner,
-                                std::vector<SegmentValue>&              out);
-    void addSegmentsForClosedRing(const std::vector<GeoCsvParser::Point>& ring,
-                                  const AscParser::Header&                header,
-                                  const GeoCsvParser::Entity*             owner,
-                                  std::vector<SegmentValue>&              out);
-
-    template <typename TreeT, typename ValueT>
-    void pickFromTree(const TreeT&                 tree,
-                      const BBox&                  localBox,
-                      const sf::RenderWindow&      window,
-                      const Heatmap&               heatmap,
-                      const GeoData&               geoData,
-                      const sf::Vector2i           mousePixel,
-                      const GeoCsvParser::Entity*& bestEntity,
-                      float&                       bestDistancePixel) const;
+    // Each appends to out
+    void collectPoints(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out);
+    void collectLineSegmentsAscending(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out);
+    void collectLineSegmentsDescending(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out);
+    void collectAreaSegments(const Heatmap& heatmap, const GeoData& geoData, std::vector<PickValue>& out);
+
+    void addSegmentsForOpenPath(GeoData::LocalSpan          points,
+                                const GeoCsvParser::Entity* owner,
+                                std::vector<PickValue>&     out);
+    void addSegmentsForClosedRing(GeoData::LocalSpan          ring,
+                                  const GeoCsvParser::Entity* owner,
+                                  std::vector<PickValue>&     out);
+
+    static std::unique_ptr<SpatialIndex> buildSpatialIndex(std::vector<PickValue> values);
+
+    // Nearest visible entity within the pick radius, nullptr if there is none
+    const GeoCsvParser::Entity* pickEntity(const sf::Vector2i      mousePixel,
+                                           const sf::RenderWindow& window,
+                                           const Heatmap&          heatmap,
+                                           const GeoData&          geoData,
+                                           float&                  outDistancePixel);
 
     void performPick(const sf::Vector2i mousePixel, sf::RenderWindow& window, const Heatmap& heatmap, const GeoData& geoData);
+
+    void        drawHoverPick(const Heatmap& heatmap, const GeoData& geoData, const sf::RenderWindow& window);
+    void        highlightEntity(const GeoCsvParser::Entity& entity,
+                                const Heatmap&              heatmap,
+                                const GeoData&              geoData,
+                                const sf::RenderWindow&     window);
+    static void drawEntityAttributes(const GeoCsvParser::Entity& entity);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,1881 @@
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+#include "colormaps.hpp"
+
+// Gist Earth and Terrain are sampled from their Matplotlib definitions with utils/convertMplColormap.py
+static const std::vector<Colormaps::Color> BLUE_TO_RED = {
+    {0.0f, 0.0f, 1.0f},
+    {1.0f, 0.0f, 0.0f},
+};
+
+static const std::vector<Colormaps::Color> GRAYSCALE = {
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+
+static const std::vector<Colormaps::Color> JET = {
+    {0.0f, 0.0f, 1.0f}, // Blue
+    {0.0f, 1.0f, 1.0f}, // Cyan
+    {0.0f, 1.0f, 0.0f}, // Green
+    {1.0f, 1.0f, 0.0f}, // Yellow
+    {1.0f, 0.0f, 0.0f}, // Red
+};
+
+static const std::vector<Colormaps::Color> TURBO = {
+    {0.18995f, 0.07176f, 0.23217f},
+    {0.19483f, 0.08339f, 0.26149f},
+    {0.19956f, 0.09498f, 0.29024f},
+    {0.20415f, 0.10652f, 0.31844f},
+    {0.20860f, 0.11802f, 0.34607f},
+    {0.21291f, 0.12947f, 0.37314f},
+    {0.21708f, 0.14087f, 0.39964f},
+    {0.22111f, 0.15223f, 0.42558f},
+    {0.22500f, 0.16354f, 0.45096f},
+    {0.22875f, 0.17481f, 0.47578f},
+    {0.23236f, 0.18603f, 0.50004f},
+    {0.23582f, 0.19720f, 0.52373f},
+    {0.23915f, 0.20833f, 0.54686f},
+    {0.24234f, 0.21941f, 0.56942f},
+    {0.24539f, 0.23044f, 0.59142f},
+    {0.24830f, 0.24143f, 0.61286f},
+    {0.25107f, 0.25237f, 0.63374f},
+    {0.25369f, 0.26327f, 0.65406f},
+    {0.25618f, 0.27412f, 0.67381f},
+    {0.25853f, 0.28492f, 0.69300f},
+    {0.26074f, 0.29568f, 0.71162f},
+    {0.26280f, 0.30639f, 0.72968f},
+    {0.26473f, 0.31706f, 0.74718f},
+    {0.26652f, 0.32768f, 0.76412f},
+    {0.26816f, 0.33825f, 0.78050f},
+    {0.26967f, 0.34878f, 0.79631f},
+    {0.27103f, 0.35926f, 0.81156f},
+    {0.27226f, 0.36970f, 0.82624f},
+    {0.27334f, 0.38008f, 0.84037f},
+    {0.27429f, 0.39043f, 0.85393f},
+    {0.27509f, 0.40072f, 0.86692f},
+    {0.27576f, 0.41097f, 0.87936f},
+    {0.27628f, 0.42118f, 0.89123f},
+    {0.27667f, 0.43134f, 0.90254f},
+    {0.27691f, 0.44145f, 0.91328f},
+    {0.27701f, 0.45152f, 0.92347f},
+    {0.27698f, 0.46153f, 0.93309f},
+    {0.27680f, 0.47151f, 0.94214f},
+    {0.27648f, 0.48144f, 0.95064f},
+    {0.27603f, 0.49132f, 0.95857f},
+    {0.27543f, 0.50115f, 0.96594f},
+    {0.27469f, 0.51094f, 0.97275f},
+    {0.27381f, 0.52069f, 0.97899f},
+    {0.27273f, 0.53040f, 0.98461f},
+    {0.27106f, 0.54015f, 0.98930f},
+    {0.26878f, 0.54995f, 0.99303f},
+    {0.26592f, 0.55979f, 0.99583f},
+    {0.26252f, 0.56967f, 0.99773f},
+    {0.25862f, 0.57958f, 0.99876f},
+    {0.25425f, 0.58950f, 0.99896f},
+    {0.24946f, 0.59943f, 0.99835f},
+    {0.24427f, 0.60937f, 0.99697f},
+    {0.23874f, 0.61931f, 0.99485f},
+    {0.23288f, 0.62923f, 0.99202f},
+    {0.22676f, 0.63913f, 0.98851f},
+    {0.22039f, 0.64901f, 0.98436f},
+    {0.21382f, 0.65886f, 0.97959f},
+    {0.20708f, 0.66866f, 0.97423f},
+    {0.20021f, 0.67842f, 0.96833f},
+    {0.19326f, 0.68812f, 0.96190f},
+    {0.18625f, 0.69775f, 0.95498f},
+    {0.17923f, 0.70732f, 0.94761f},
+    {0.17223f, 0.71680f, 0.93981f},
+    {0.16529f, 0.72620f, 0.93161f},
+    {0.15844f, 0.73551f, 0.92305f},
+    {0.15173f, 0.74472f, 0.91416f},
+    {0.14519f, 0.75381f, 0.90496f},
+    {0.13886f, 0.76279f, 0.89550f},
+    {0.13278f, 0.77165f, 0.88580f},
+    {0.12698f, 0.78037f, 0.87590f},
+    {0.12151f, 0.78896f, 0.86581f},
+    {0.11639f, 0.79740f, 0.85559f},
+    {0.11167f, 0.80569f, 0.84525f},
+    {0.10738f, 0.81381f, 0.83484f},
+    {0.10357f, 0.82177f, 0.82437f},
+    {0.10026f, 0.82955f, 0.81389f},
+    {0.09750f, 0.83714f, 0.80342f},
+    {0.09532f, 0.84455f, 0.79299f},
+    {0.09377f, 0.85175f, 0.78264f},
+    {0.09287f, 0.85875f, 0.77240f},
+    {0.09267f, 0.86554f, 0.76230f},
+    {0.09320f, 0.87211f, 0.75237f},
+    {0.09451f, 0.87844f, 0.74265f},
+    {0.09662f, 0.88454f, 0.73316f},
+    {0.09958f, 0.89040f, 0.72393f},
+    {0.10342f, 0.89600f, 0.71500f},
+    {0.10815f, 0.90142f, 0.70599f},
+    {0.11374f, 0.90673f, 0.69651f},
+    {0.12014f, 0.91193f, 0.68660f},
+    {0.12733f, 0.91701f, 0.67627f},
+    {0.13526f, 0.92197f, 0.66556f},
+    {0.14391f, 0.92680f, 0.65448f},
+    {0.15323f, 0.93151f, 0.64308f},
+    {0.16319f, 0.93609f, 0.63137f},
+    {0.17377f, 0.94053f, 0.61938f},
+    {0.18491f, 0.94484f, 0.60713f},
+    {0.19659f, 0.94901f, 0.59466f},
+    {0.20877f, 0.95304f, 0.58199f},
+    {0.22142f, 0.95692f, 0.56914f},
+    {0.23449f, 0.96065f, 0.55614f},
+    {0.24797f, 0.96423f, 0.54303f},
+    {0.26180f, 0.96765f, 0.52981f},
+    {0.27597f, 0.97092f, 0.51653f},
+    {0.29042f, 0.97403f, 0.50321f},
+    {0.30513f, 0.97697f, 0.48987f},
+    {0.32006f, 0.97974f, 0.47654f},
+    {0.33517f, 0.98234f, 0.46325f},
+    {0.35043f, 0.98477f, 0.45002f},
+    {0.36581f, 0.98702f, 0.43688f},
+    {0.38127f, 0.98909f, 0.42386f},
+    {0.39678f, 0.99098f, 0.41098f},
+    {0.41229f, 0.99268f, 0.39826f},
+    {0.42778f, 0.99419f, 0.38575f},
+    {0.44321f, 0.99551f, 0.37345f},
+    {0.45854f, 0.99663f, 0.36140f},
+    {0.47375f, 0.99755f, 0.34963f},
+    {0.48879f, 0.99828f, 0.33816f},
+    {0.50362f, 0.99879f, 0.32701f},
+    {0.51822f, 0.99910f, 0.31622f},
+    {0.53255f, 0.99919f, 0.30581f},
+    {0.54658f, 0.99907f, 0.29581f},
+    {0.56026f, 0.99873f, 0.28623f},
+    {0.57357f, 0.99817f, 0.27712f},
+    {0.58646f, 0.99739f, 0.26849f},
+    {0.59891f, 0.99638f, 0.26038f},
+    {0.61088f, 0.99514f, 0.25280f},
+    {0.62233f, 0.99366f, 0.24579f},
+    {0.63323f, 0.99195f, 0.23937f},
+    {0.64362f, 0.98999f, 0.23356f},
+    {0.65394f, 0.98775f, 0.22835f},
+    {0.66428f, 0.98524f, 0.22370f},
+    {0.67462f, 0.98246f, 0.21960f},
+    {0.68494f, 0.97941f, 0.21602f},
+    {0.69525f, 0.97610f, 0.21294f},
+    {0.70553f, 0.97255f, 0.21032f},
+    {0.71577f, 0.96875f, 0.20815f},
+    {0.72596f, 0.96470f, 0.20640f},
+    {0.73610f, 0.96043f, 0.20504f},
+    {0.74617f, 0.95593f, 0.20406f},
+    {0.75617f, 0.95121f, 0.20343f},
+    {0.76608f, 0.94627f, 0.20311f},
+    {0.77591f, 0.94113f, 0.20310f},
+    {0.78563f, 0.93579f, 0.20336f},
+    {0.79524f, 0.93025f, 0.20386f},
+    {0.80473f, 0.92452f, 0.20459f},
+    {0.81410f, 0.91861f, 0.20552f},
+    {0.82333f, 0.91253f, 0.20663f},
+    {0.83241f, 0.90627f, 0.20788f},
+    {0.84133f, 0.89986f, 0.20926f},
+    {0.85010f, 0.89328f, 0.21074f},
+    {0.85868f, 0.88655f, 0.21230f},
+    {0.86709f, 0.87968f, 0.21391f},
+    {0.87530f, 0.87267f, 0.21555f},
+    {0.88331f, 0.86553f, 0.21719f},
+    {0.89112f, 0.85826f, 0.21880f},
+    {0.89870f, 0.85087f, 0.22038f},
+    {0.90605f, 0.84337f, 0.22188f},
+    {0.91317f, 0.83576f, 0.22328f},
+    {0.92004f, 0.82806f, 0.22456f},
+    {0.92666f, 0.82025f, 0.22570f},
+    {0.93301f, 0.81236f, 0.22667f},
+    {0.93909f, 0.80439f, 0.22744f},
+    {0.94489f, 0.79634f, 0.22800f},
+    {0.95039f, 0.78823f, 0.22831f},
+    {0.95560f, 0.78005f, 0.22836f},
+    {0.96049f, 0.77181f, 0.22811f},
+    {0.96507f, 0.76352f, 0.22754f},
+    {0.96931f, 0.75519f, 0.22663f},
+    {0.97323f, 0.74682f, 0.22536f},
+    {0.97679f, 0.73842f, 0.22369f},
+    {0.98000f, 0.73000f, 0.22161f},
+    {0.98289f, 0.72140f, 0.21918f},
+    {0.98549f, 0.71250f, 0.21650f},
+    {0.98781f, 0.70330f, 0.21358f},
+    {0.98986f, 0.69382f, 0.21043f},
+    {0.99163f, 0.68408f, 0.20706f},
+    {0.99314f, 0.67408f, 0.20348f},
+    {0.99438f, 0.66386f, 0.19971f},
+    {0.99535f, 0.65341f, 0.19577f},
+    {0.99607f, 0.64277f, 0.19165f},
+    {0.99654f, 0.63193f, 0.18738f},
+    {0.99675f, 0.62093f, 0.18297f},
+    {0.99672f, 0.60977f, 0.17842f},
+    {0.99644f, 0.59846f, 0.17376f},
+    {0.99593f, 0.58703f, 0.16899f},
+    {0.99517f, 0.57549f, 0.16412f},
+    {0.99419f, 0.56386f, 0.15918f},
+    {0.99297f, 0.55214f, 0.15417f},
+    {0.99153f, 0.54036f, 0.14910f},
+    {0.98987f, 0.52854f, 0.14398f},
+    {0.98799f, 0.51667f, 0.13883f},
+    {0.98590f, 0.50479f, 0.13367f},
+    {0.98360f, 0.49291f, 0.12849f},
+    {0.98108f, 0.48104f, 0.12332f},
+    {0.97837f, 0.46920f, 0.11817f},
+    {0.97545f, 0.45740f, 0.11305f},
+    {0.97234f, 0.44565f, 0.10797f},
+    {0.96904f, 0.43399f, 0.10294f},
+    {0.96555f, 0.42241f, 0.09798f},
+    {0.96187f, 0.41093f, 0.09310f},
+    {0.95801f, 0.39958f, 0.08831f},
+    {0.95398f, 0.38836f, 0.08362f},
+    {0.94977f, 0.37729f, 0.07905f},
+    {0.94538f, 0.36638f, 0.07461f},
+    {0.94084f, 0.35566f, 0.07031f},
+    {0.93612f, 0.34513f, 0.06616f},
+    {0.93125f, 0.33482f, 0.06218f},
+    {0.92623f, 0.32473f, 0.05837f},
+    {0.92105f, 0.31489f, 0.05475f},
+    {0.91572f, 0.30530f, 0.05134f},
+    {0.91024f, 0.29599f, 0.04814f},
+    {0.90463f, 0.28696f, 0.04516f},
+    {0.89888f, 0.27824f, 0.04243f},
+    {0.89298f, 0.26981f, 0.03993f},
+    {0.88691f, 0.26152f, 0.03753f},
+    {0.88066f, 0.25334f, 0.03521f},
+    {0.87422f, 0.24526f, 0.03297f},
+    {0.86760f, 0.23730f, 0.03082f},
+    {0.86079f, 0.22945f, 0.02875f},
+    {0.85380f, 0.22170f, 0.02677f},
+    {0.84662f, 0.21407f, 0.02487f},
+    {0.83926f, 0.20654f, 0.02305f},
+    {0.83172f, 0.19912f, 0.02131f},
+    {0.82399f, 0.19182f, 0.01966f},
+    {0.81608f, 0.18462f, 0.01809f},
+    {0.80799f, 0.17753f, 0.01660f},
+    {0.79971f, 0.17055f, 0.01520f},
+    {0.79125f, 0.16368f, 0.01387f},
+    {0.78260f, 0.15693f, 0.01264f},
+    {0.77377f, 0.15028f, 0.01148f},
+    {0.76476f, 0.14374f, 0.01041f},
+    {0.75556f, 0.13731f, 0.00942f},
+    {0.74617f, 0.13098f, 0.00851f},
+    {0.73661f, 0.12477f, 0.00769f},
+    {0.72686f, 0.11867f, 0.00695f},
+    {0.71692f, 0.11268f, 0.00629f},
+    {0.70680f, 0.10680f, 0.00571f},
+    {0.69650f, 0.10102f, 0.00522f},
+    {0.68602f, 0.09536f, 0.00481f},
+    {0.67535f, 0.08980f, 0.00449f},
+    {0.66449f, 0.08436f, 0.00424f},
+    {0.65345f, 0.07902f, 0.00408f},
+    {0.64223f, 0.07380f, 0.00401f},
+    {0.63082f, 0.06868f, 0.00401f},
+    {0.61923f, 0.06367f, 0.00410f},
+    {0.60746f, 0.05878f, 0.00427f},
+    {0.59550f, 0.05399f, 0.00453f},
+    {0.58336f, 0.04931f, 0.00486f},
+    {0.57103f, 0.04474f, 0.00529f},
+    {0.55852f, 0.04028f, 0.00579f},
+    {0.54583f, 0.03593f, 0.00638f},
+    {0.53295f, 0.03169f, 0.00705f},
+    {0.51989f, 0.02756f, 0.00780f},
+    {0.50664f, 0.02354f, 0.00863f},
+    {0.49321f, 0.01963f, 0.00955f},
+    {0.47960f, 0.01583f, 0.01055f},
+};
+
+static const std::vector<Colormaps::Color> VIRIDIS = {
+    {0.267004f, 0.004874f, 0.329415f},
+    {0.268510f, 0.009605f, 0.335427f},
+    {0.269944f, 0.014625f, 0.341379f},
+    {0.271305f, 0.019942f, 0.347269f},
+    {0.272594f, 0.025563f, 0.353093f},
+    {0.273809f, 0.031497f, 0.358853f},
+    {0.274952f, 0.037752f, 0.364543f},
+    {0.276022f, 0.044167f, 0.370164f},
+    {0.277018f, 0.050344f, 0.375715f},
+    {0.277941f, 0.056324f, 0.381191f},
+    {0.278791f, 0.062145f, 0.386592f},
+    {0.279566f, 0.067836f, 0.391917f},
+    {0.280267f, 0.073417f, 0.397163f},
+    {0.280894f, 0.078907f, 0.402329f},
+    {0.281446f, 0.084320f, 0.407414f},
+    {0.281924f, 0.089666f, 0.412415f},
+    {0.282327f, 0.094955f, 0.417331f},
+    {0.282656f, 0.100196f, 0.422160f},
+    {0.282910f, 0.105393f, 0.426902f},
+    {0.283091f, 0.110553f, 0.431554f},
+    {0.283197f, 0.115680f, 0.436115f},
+    {0.283229f, 0.120777f, 0.440584f},
+    {0.283187f, 0.125848f, 0.444960f},
+    {0.283072f, 0.130895f, 0.449241f},
+    {0.282884f, 0.135920f, 0.453427f},
+    {0.282623f, 0.140926f, 0.457517f},
+    {0.282290f, 0.145912f, 0.461510f},
+    {0.281887f, 0.150881f, 0.465405f},
+    {0.281412f, 0.155834f, 0.469201f},
+    {0.280868f, 0.160771f, 0.472899f},
+    {0.280255f, 0.165693f, 0.476498f},
+    {0.279574f, 0.170599f, 0.479997f},
+    {0.278826f, 0.175490f, 0.483397f},
+    {0.278012f, 0.180367f, 0.486697f},
+    {0.277134f, 0.185228f, 0.489898f},
+    {0.276194f, 0.190074f, 0.493001f},
+    {0.275191f, 0.194905f, 0.496005f},
+    {0.274128f, 0.199721f, 0.498911f},
+    {0.273006f, 0.204520f, 0.501721f},
+    {0.271828f, 0.209303f, 0.504434f},
+    {0.270595f, 0.214069f, 0.507052f},
+    {0.269308f, 0.218818f, 0.509577f},
+    {0.267968f, 0.223549f, 0.512008f},
+    {0.266580f, 0.228262f, 0.514349f},
+    {0.265145f, 0.232956f, 0.516599f},
+    {0.263663f, 0.237631f, 0.518762f},
+    {0.262138f, 0.242286f, 0.520837f},
+    {0.260571f, 0.246922f, 0.522828f},
+    {0.258965f, 0.251537f, 0.524736f},
+    {0.257322f, 0.256130f, 0.526563f},
+    {0.255645f, 0.260703f, 0.528312f},
+    {0.253935f, 0.265254f, 0.529983f},
+    {0.252194f, 0.269783f, 0.531579f},
+    {0.250425f, 0.274290f, 0.533103f},
+    {0.248629f, 0.278775f, 0.534556f},
+    {0.246811f, 0.283237f, 0.535941f},
+    {0.244972f, 0.287675f, 0.537260f},
+    {0.243113f, 0.292092f, 0.538516f},
+    {0.241237f, 0.296485f, 0.539709f},
+    {0.239346f, 0.300855f, 0.540844f},
+    {0.237441f, 0.305202f, 0.541921f},
+    {0.235526f, 0.309527f, 0.542944f},
+    {0.233603f, 0.313828f, 0.543914f},
+    {0.231674f, 0.318106f, 0.544834f},
+    {0.229739f, 0.322361f, 0.545706f},
+    {0.227802f, 0.326594f, 0.546532f},
+    {0.225863f, 0.330805f, 0.547314f},
+    {0.223925f, 0.334994f, 0.548053f},
+    {0.221989f, 0.339161f, 0.548752f},
+    {0.220057f, 0.343307f, 0.549413f},
+    {0.218130f, 0.347432f, 0.550038f},
+    {0.216210f, 0.351535f, 0.550627f},
+    {0.214298f, 0.355619f, 0.551184f},
+    {0.212395f, 0.359683f, 0.551710f},
+    {0.210503f, 0.363727f, 0.552206f},
+    {0.208623f, 0.367752f, 0.552675f},
+    {0.206756f, 0.371758f, 0.553117f},
+    {0.204903f, 0.375746f, 0.553533f},
+    {0.203063f, 0.379716f, 0.553925f},
+    {0.201239f, 0.383670f, 0.554294f},
+    {0.199430f, 0.387607f, 0.554642f},
+    {0.197636f, 0.391528f, 0.554969f},
+    {0.195860f, 0.395433f, 0.555276f},
+    {0.194100f, 0.399323f, 0.555565f},
+    {0.192357f, 0.403199f, 0.555836f},
+    {0.190631f, 0.407061f, 0.556089f},
+    {0.188923f, 0.410910f, 0.556326f},
+    {0.187231f, 0.414746f, 0.556547f},
+    {0.185556f, 0.418570f, 0.556753f},
+    {0.183898f, 0.422383f, 0.556944f},
+    {0.182256f, 0.426184f, 0.557120f},
+    {0.180629f, 0.429975f, 0.557282f},
+    {0.179019f, 0.433756f, 0.557430f},
+    {0.177423f, 0.437527f, 0.557565f},
+    {0.175841f, 0.441290f, 0.557685f},
+    {0.174274f, 0.445044f, 0.557792f},
+    {0.172719f, 0.448791f, 0.557885f},
+    {0.171176f, 0.452530f, 0.557965f},
+    {0.169646f, 0.456262f, 0.558030f},
+    {0.168126f, 0.459988f, 0.558082f},
+    {0.166617f, 0.463708f, 0.558119f},
+    {0.165117f, 0.467423f, 0.558141f},
+    {0.163625f, 0.471133f, 0.558148f},
+    {0.162142f, 0.474838f, 0.558140f},
+    {0.160665f, 0.478540f, 0.558115f},
+    {0.159194f, 0.482237f, 0.558073f},
+    {0.157729f, 0.485932f, 0.558013f},
+    {0.156270f, 0.489624f, 0.557936f},
+    {0.154815f, 0.493313f, 0.557840f},
+    {0.153364f, 0.497000f, 0.557724f},
+    {0.151918f, 0.500685f, 0.557587f},
+    {0.150476f, 0.504369f, 0.557430f},
+    {0.149039f, 0.508051f, 0.557250f},
+    {0.147607f, 0.511733f, 0.557049f},
+    {0.146180f, 0.515413f, 0.556823f},
+    {0.144759f, 0.519093f, 0.556572f},
+    {0.143343f, 0.522773f, 0.556295f},
+    {0.141935f, 0.526453f, 0.555991f},
+    {0.140536f, 0.530132f, 0.555659f},
+    {0.139147f, 0.533812f, 0.555298f},
+    {0.137770f, 0.537492f, 0.554906f},
+    {0.136408f, 0.541173f, 0.554483f},
+    {0.135066f, 0.544853f, 0.554029f},
+    {0.133743f, 0.548535f, 0.553541f},
+    {0.132444f, 0.552216f, 0.553018f},
+    {0.131172f, 0.555899f, 0.552459f},
+    {0.129933f, 0.559582f, 0.551864f},
+    {0.128729f, 0.563265f, 0.551229f},
+    {0.127568f, 0.566949f, 0.550556f},
+    {0.126453f, 0.570633f, 0.549841f},
+    {0.125394f, 0.574318f, 0.549086f},
+    {0.124395f, 0.578002f, 0.548287f},
+    {0.123463f, 0.581687f, 0.547445f},
+    {0.122606f, 0.585371f, 0.546557f},
+    {0.121831f, 0.589055f, 0.545623f},
+    {0.121148f, 0.592739f, 0.544641f},
+    {0.120565f, 0.596422f, 0.543611f},
+    {0.120092f, 0.600104f, 0.542530f},
+    {0.119738f, 0.603785f, 0.541400f},
+    {0.119512f, 0.607464f, 0.540218f},
+    {0.119423f, 0.611141f, 0.538982f},
+    {0.119483f, 0.614817f, 0.537692f},
+    {0.119699f, 0.618490f, 0.536347f},
+    {0.120081f, 0.622161f, 0.534946f},
+    {0.120638f, 0.625828f, 0.533488f},
+    {0.121380f, 0.629492f, 0.531973f},
+    {0.122312f, 0.633153f, 0.530398f},
+    {0.123444f, 0.636809f, 0.528763f},
+    {0.124780f, 0.640461f, 0.527068f},
+    {0.126326f, 0.644107f, 0.525311f},
+    {0.128087f, 0.647749f, 0.523491f},
+    {0.130067f, 0.651384f, 0.521608f},
+    {0.132268f, 0.655014f, 0.519661f},
+    {0.134692f, 0.658636f, 0.517649f},
+    {0.137339f, 0.662252f, 0.515571f},
+    {0.140210f, 0.665859f, 0.513427f},
+    {0.143303f, 0.669459f, 0.511215f},
+    {0.146616f, 0.673050f, 0.508936f},
+    {0.150148f, 0.676631f, 0.506589f},
+    {0.153894f, 0.680203f, 0.504172f},
+    {0.157851f, 0.683765f, 0.501686f},
+    {0.162016f, 0.687316f, 0.499129f},
+    {0.166383f, 0.690856f, 0.496502f},
+    {0.170948f, 0.694384f, 0.493803f},
+    {0.175707f, 0.697900f, 0.491033f},
+    {0.180653f, 0.701402f, 0.488189f},
+    {0.185783f, 0.704891f, 0.485273f},
+    {0.191090f, 0.708366f, 0.482284f},
+    {0.196571f, 0.711827f, 0.479221f},
+    {0.202219f, 0.715272f, 0.476084f},
+    {0.208030f, 0.718701f, 0.472873f},
+    {0.214000f, 0.722114f, 0.469588f},
+    {0.220124f, 0.725509f, 0.466226f},
+    {0.226397f, 0.728888f, 0.462789f},
+    {0.232815f, 0.732247f, 0.459277f},
+    {0.239374f, 0.735588f, 0.455688f},
+    {0.246070f, 0.738910f, 0.452024f},
+    {0.252899f, 0.742211f, 0.448284f},
+    {0.259857f, 0.745492f, 0.444467f},
+    {0.266941f, 0.748751f, 0.440573f},
+    {0.274149f, 0.751988f, 0.436601f},
+    {0.281477f, 0.755203f, 0.432552f},
+    {0.288921f, 0.758394f, 0.428426f},
+    {0.296479f, 0.761561f, 0.424223f},
+    {0.304148f, 0.764704f, 0.419943f},
+    {0.311925f, 0.767822f, 0.415586f},
+    {0.319809f, 0.770914f, 0.411152f},
+    {0.327796f, 0.773980f, 0.40664f},
+    {0.335885f, 0.777018f, 0.402049f},
+    {0.344074f, 0.780029f, 0.397381f},
+    {0.352360f, 0.783011f, 0.392636f},
+    {0.360741f, 0.785964f, 0.387814f},
+    {0.369214f, 0.788888f, 0.382914f},
+    {0.377779f, 0.791781f, 0.377939f},
+    {0.386433f, 0.794644f, 0.372886f},
+    {0.395174f, 0.797475f, 0.367757f},
+    {0.404001f, 0.800275f, 0.362552f},
+    {0.412913f, 0.803041f, 0.357269f},
+    {0.421908f, 0.805774f, 0.351910f},
+    {0.430983f, 0.808473f, 0.346476f},
+    {0.440137f, 0.811138f, 0.340967f},
+    {0.449368f, 0.813768f, 0.335384f},
+    {0.458674f, 0.816363f, 0.329727f},
+    {0.468053f, 0.818921f, 0.323998f},
+    {0.477504f, 0.821444f, 0.318195f},
+    {0.487026f, 0.823929f, 0.312321f},
+    {0.496615f, 0.826376f, 0.306377f},
+    {0.506271f, 0.828786f, 0.300362f},
+    {0.515992f, 0.831158f, 0.294279f},
+    {0.525776f, 0.833491f, 0.288127f},
+    {0.535621f, 0.835785f, 0.281908f},
+    {0.545524f, 0.838039f, 0.275626f},
+    {0.555484f, 0.840254f, 0.269281f},
+    {0.565498f, 0.842430f, 0.262877f},
+    {0.575563f, 0.844566f, 0.256415f},
+    {0.585678f, 0.846661f, 0.249897f},
+    {0.595839f, 0.848717f, 0.243329f},
+    {0.606045f, 0.850733f, 0.236712f},
+    {0.616293f, 0.852709f, 0.230052f},
+    {0.626579f, 0.854645f, 0.223353f},
+    {0.636902f, 0.856542f, 0.216620f},
+    {0.647257f, 0.858400f, 0.209861f},
+    {0.657642f, 0.860219f, 0.203082f},
+    {0.668054f, 0.861999f, 0.196293f},
+    {0.678489f, 0.863742f, 0.189503f},
+    {0.688944f, 0.865448f, 0.182725f},
+    {0.699415f, 0.867117f, 0.175971f},
+    {0.709898f, 0.868751f, 0.169257f},
+    {0.720391f, 0.870350f, 0.162603f},
+    {0.730889f, 0.871916f, 0.156029f},
+    {0.741388f, 0.873449f, 0.149561f},
+    {0.751884f, 0.874951f, 0.143228f},
+    {0.762373f, 0.876424f, 0.137064f},
+    {0.772852f, 0.877868f, 0.131109f},
+    {0.783315f, 0.879285f, 0.125405f},
+    {0.793760f, 0.880678f, 0.120005f},
+    {0.804182f, 0.882046f, 0.114965f},
+    {0.814576f, 0.883393f, 0.110347f},
+    {0.824940f, 0.884720f, 0.106217f},
+    {0.835270f, 0.886029f, 0.102646f},
+    {0.845561f, 0.887322f, 0.099702f},
+    {0.855810f, 0.888601f, 0.097452f},
+    {0.866013f, 0.889868f, 0.095953f},
+    {0.876168f, 0.891125f, 0.095250f},
+    {0.886271f, 0.892374f, 0.095374f},
+    {0.896320f, 0.893616f, 0.096335f},
+    {0.906311f, 0.894855f, 0.098125f},
+    {0.916242f, 0.896091f, 0.100717f},
+    {0.926106f, 0.897330f, 0.104071f},
+    {0.935904f, 0.898570f, 0.108131f},
+    {0.945636f, 0.899815f, 0.112838f},
+    {0.955360f, 0.901065f, 0.118128f},
+    {0.964894f, 0.902323f, 0.123941f},
+    {0.974417f, 0.903590f, 0.130215f},
+    {0.983868f, 0.904867f, 0.136897f},
+    {0.993248f, 0.906157f, 0.143936f},
+};
+
+static const std::vector<Colormaps::Color> PLASMA = {
+    {0.050383f, 0.029803f, 0.527975f},
+    {0.063536f, 0.028426f, 0.533124f},
+    {0.075353f, 0.027206f, 0.538007f},
+    {0.086222f, 0.026125f, 0.542658f},
+    {0.096379f, 0.025165f, 0.547103f},
+    {0.105980f, 0.024309f, 0.551368f},
+    {0.115124f, 0.023556f, 0.555468f},
+    {0.123903f, 0.022878f, 0.559423f},
+    {0.132381f, 0.022258f, 0.563250f},
+    {0.140603f, 0.021687f, 0.566959f},
+    {0.148607f, 0.021154f, 0.570562f},
+    {0.156421f, 0.020651f, 0.574065f},
+    {0.164070f, 0.020171f, 0.577478f},
+    {0.171574f, 0.019706f, 0.580806f},
+    {0.178950f, 0.019252f, 0.584054f},
+    {0.186213f, 0.018803f, 0.587228f},
+    {0.193374f, 0.018354f, 0.590330f},
+    {0.200445f, 0.017902f, 0.593364f},
+    {0.207435f, 0.017442f, 0.596333f},
+    {0.214350f, 0.016973f, 0.599239f},
+    {0.221197f, 0.016497f, 0.602083f},
+    {0.227983f, 0.016007f, 0.604867f},
+    {0.234715f, 0.015502f, 0.607592f},
+    {0.241396f, 0.014979f, 0.610259f},
+    {0.248032f, 0.014439f, 0.612868f},
+    {0.254627f, 0.013882f, 0.615419f},
+    {0.261183f, 0.013308f, 0.617911f},
+    {0.267703f, 0.012716f, 0.620346f},
+    {0.274191f, 0.012109f, 0.622722f},
+    {0.280648f, 0.011488f, 0.625038f},
+    {0.287076f, 0.010855f, 0.627295f},
+    {0.293478f, 0.010213f, 0.629490f},
+    {0.299855f, 0.009561f, 0.631624f},
+    {0.306210f, 0.008902f, 0.633694f},
+    {0.312543f, 0.008239f, 0.635700f},
+    {0.318856f, 0.007576f, 0.637640f},
+    {0.325150f, 0.006915f, 0.639512f},
+    {0.331426f, 0.006261f, 0.641316f},
+    {0.337683f, 0.005618f, 0.643049f},
+    {0.343925f, 0.004991f, 0.644710f},
+    {0.350150f, 0.004382f, 0.646298f},
+    {0.356359f, 0.003798f, 0.647810f},
+    {0.362553f, 0.003243f, 0.649245f},
+    {0.368733f, 0.002724f, 0.650601f},
+    {0.374897f, 0.002245f, 0.651876f},
+    {0.381047f, 0.001814f, 0.653068f},
+    {0.387183f, 0.001434f, 0.654177f},
+    {0.393304f, 0.001114f, 0.655199f},
+    {0.399411f, 0.000859f, 0.656133f},
+    {0.405503f, 0.000678f, 0.656977f},
+    {0.411580f, 0.000577f, 0.657730f},
+    {0.417642f, 0.000564f, 0.658390f},
+    {0.423689f, 0.000646f, 0.658956f},
+    {0.429719f, 0.000831f, 0.659425f},
+    {0.435734f, 0.001127f, 0.659797f},
+    {0.441732f, 0.001540f, 0.660069f},
+    {0.447714f, 0.002080f, 0.660240f},
+    {0.453677f, 0.002755f, 0.660310f},
+    {0.459623f, 0.003574f, 0.660277f},
+    {0.465550f, 0.004545f, 0.660139f},
+    {0.471457f, 0.005678f, 0.659897f},
+    {0.477344f, 0.006980f, 0.659549f},
+    {0.483210f, 0.008460f, 0.659095f},
+    {0.489055f, 0.010127f, 0.658534f},
+    {0.494877f, 0.011990f, 0.657865f},
+    {0.500678f, 0.014055f, 0.657088f},
+    {0.506454f, 0.016333f, 0.656202f},
+    {0.512206f, 0.018833f, 0.655209f},
+    {0.517933f, 0.021563f, 0.654109f},
+    {0.523633f, 0.024532f, 0.652901f},
+    {0.529306f, 0.027747f, 0.651586f},
+    {0.534952f, 0.031217f, 0.650165f},
+    {0.540570f, 0.034950f, 0.648640f},
+    {0.546157f, 0.038954f, 0.647010f},
+    {0.551715f, 0.043136f, 0.645277f},
+    {0.557243f, 0.047331f, 0.643443f},
+    {0.562738f, 0.051545f, 0.641509f},
+    {0.568201f, 0.055778f, 0.639477f},
+    {0.573632f, 0.060028f, 0.637349f},
+    {0.579029f, 0.064296f, 0.635126f},
+    {0.584391f, 0.068579f, 0.632812f},
+    {0.589719f, 0.072878f, 0.630408f},
+    {0.595011f, 0.077190f, 0.627917f},
+    {0.600266f, 0.081516f, 0.625342f},
+    {0.605485f, 0.085854f, 0.622686f},
+    {0.610667f, 0.090204f, 0.619951f},
+    {0.615812f, 0.094564f, 0.617140f},
+    {0.620919f, 0.098934f, 0.614257f},
+    {0.625987f, 0.103312f, 0.611305f},
+    {0.631017f, 0.107699f, 0.608287f},
+    {0.636008f, 0.112092f, 0.605205f},
+    {0.640959f, 0.116492f, 0.602065f},
+    {0.645872f, 0.120898f, 0.598867f},
+    {0.650746f, 0.125309f, 0.595617f},
+    {0.655580f, 0.129725f, 0.592317f},
+    {0.660374f, 0.134144f, 0.588971f},
+    {0.665129f, 0.138566f, 0.585582f},
+    {0.669845f, 0.142992f, 0.582154f},
+    {0.674522f, 0.147419f, 0.578688f},
+    {0.679160f, 0.151848f, 0.575189f},
+    {0.683758f, 0.156278f, 0.571660f},
+    {0.688318f, 0.160709f, 0.568103f},
+    {0.692840f, 0.165141f, 0.564522f},
+    {0.697324f, 0.169573f, 0.560919f},
+    {0.701769f, 0.174005f, 0.557296f},
+    {0.706178f, 0.178437f, 0.553657f},
+    {0.710549f, 0.182868f, 0.550004f},
+    {0.714883f, 0.187299f, 0.546338f},
+    {0.719181f, 0.191729f, 0.542663f},
+    {0.723444f, 0.196158f, 0.538981f},
+    {0.727670f, 0.200586f, 0.535293f},
+    {0.731862f, 0.205013f, 0.531601f},
+    {0.736019f, 0.209439f, 0.527908f},
+    {0.740143f, 0.213864f, 0.524216f},
+    {0.744232f, 0.218288f, 0.520524f},
+    {0.748289f, 0.222711f, 0.516834f},
+    {0.752312f, 0.227133f, 0.513149f},
+    {0.756304f, 0.231555f, 0.509468f},
+    {0.760264f, 0.235976f, 0.505794f},
+    {0.764193f, 0.240396f, 0.502126f},
+    {0.768090f, 0.244817f, 0.498465f},
+    {0.771958f, 0.249237f, 0.494813f},
+    {0.775796f, 0.253658f, 0.491171f},
+    {0.779604f, 0.258078f, 0.487539f},
+    {0.783383f, 0.262500f, 0.483918f},
+    {0.787133f, 0.266922f, 0.480307f},
+    {0.790855f, 0.271345f, 0.476706f},
+    {0.794549f, 0.275770f, 0.473117f},
+    {0.798216f, 0.280197f, 0.469538f},
+    {0.801855f, 0.284626f, 0.465971f},
+    {0.805467f, 0.289057f, 0.462415f},
+    {0.809052f, 0.293491f, 0.458870f},
+    {0.812612f, 0.297928f, 0.455338f},
+    {0.816144f, 0.302368f, 0.451816f},
+    {0.819651f, 0.306812f, 0.448306f},
+    {0.823132f, 0.311261f, 0.444806f},
+    {0.826588f, 0.315714f, 0.441316f},
+    {0.830018f, 0.320172f, 0.437836f},
+    {0.833422f, 0.324635f, 0.434366f},
+    {0.836801f, 0.329105f, 0.430905f},
+    {0.840155f, 0.333580f, 0.427455f},
+    {0.843484f, 0.338062f, 0.424013f},
+    {0.846788f, 0.342551f, 0.420579f},
+    {0.850066f, 0.347048f, 0.417153f},
+    {0.853319f, 0.351553f, 0.413734f},
+    {0.856547f, 0.356066f, 0.410322f},
+    {0.859750f, 0.360588f, 0.406917f},
+    {0.862927f, 0.365119f, 0.403519f},
+    {0.866078f, 0.369660f, 0.400126f},
+    {0.869203f, 0.374212f, 0.396738f},
+    {0.872303f, 0.378774f, 0.393355f},
+    {0.875376f, 0.383347f, 0.389976f},
+    {0.878423f, 0.387932f, 0.386600f},
+    {0.881443f, 0.392529f, 0.383229f},
+    {0.884436f, 0.397139f, 0.379860f},
+    {0.887402f, 0.401762f, 0.376494f},
+    {0.890340f, 0.406398f, 0.373130f},
+    {0.893250f, 0.411048f, 0.369768f},
+    {0.896131f, 0.415712f, 0.366407f},
+    {0.898984f, 0.420392f, 0.363047f},
+    {0.901807f, 0.425087f, 0.359688f},
+    {0.904601f, 0.429797f, 0.356329f},
+    {0.907365f, 0.434524f, 0.352970f},
+    {0.910098f, 0.439268f, 0.349610f},
+    {0.912800f, 0.444029f, 0.346251f},
+    {0.915471f, 0.448807f, 0.342890f},
+    {0.918109f, 0.453603f, 0.339529f},
+    {0.920714f, 0.458417f, 0.336166f},
+    {0.923287f, 0.463251f, 0.332801f},
+    {0.925825f, 0.468103f, 0.329435f},
+    {0.928329f, 0.472975f, 0.326067f},
+    {0.930798f, 0.477867f, 0.322697f},
+    {0.933232f, 0.482780f, 0.319325f},
+    {0.935630f, 0.487712f, 0.315952f},
+    {0.937990f, 0.492667f, 0.312575f},
+    {0.940313f, 0.497642f, 0.309197f},
+    {0.942598f, 0.502639f, 0.305816f},
+    {0.944844f, 0.507658f, 0.302433f},
+    {0.947051f, 0.512699f, 0.299049f},
+    {0.949217f, 0.517763f, 0.295662f},
+    {0.951344f, 0.522850f, 0.292275f},
+    {0.953428f, 0.527960f, 0.288883f},
+    {0.955470f, 0.533093f, 0.285490f},
+    {0.957469f, 0.538250f, 0.282096f},
+    {0.959424f, 0.543431f, 0.278701f},
+    {0.961336f, 0.548636f, 0.275305f},
+    {0.963203f, 0.553865f, 0.271909f},
+    {0.965024f, 0.559118f, 0.268513f},
+    {0.966798f, 0.564396f, 0.265118f},
+    {0.968526f, 0.569700f, 0.261721f},
+    {0.970205f, 0.575028f, 0.258325f},
+    {0.971835f, 0.580382f, 0.254931f},
+    {0.973416f, 0.585761f, 0.251540f},
+    {0.974947f, 0.591165f, 0.248151f},
+    {0.976428f, 0.596595f, 0.244767f},
+    {0.977856f, 0.602051f, 0.241387f},
+    {0.979233f, 0.607532f, 0.238013f},
+    {0.980556f, 0.613039f, 0.234646f},
+    {0.981826f, 0.618572f, 0.231287f},
+    {0.983041f, 0.624131f, 0.227937f},
+    {0.984199f, 0.629718f, 0.224595f},
+    {0.985301f, 0.635330f, 0.221265f},
+    {0.986345f, 0.640969f, 0.217948f},
+    {0.987332f, 0.646633f, 0.214648f},
+    {0.988260f, 0.652325f, 0.211364f},
+    {0.989128f, 0.658043f, 0.208100f},
+    {0.989935f, 0.663787f, 0.204859f},
+    {0.990681f, 0.669558f, 0.201642f},
+    {0.991365f, 0.675355f, 0.198453f},
+    {0.991985f, 0.681179f, 0.195295f},
+    {0.992541f, 0.687030f, 0.192170f},
+    {0.993032f, 0.692907f, 0.189084f},
+    {0.993456f, 0.698810f, 0.186041f},
+    {0.993814f, 0.704741f, 0.183043f},
+    {0.994103f, 0.710698f, 0.180097f},
+    {0.994324f, 0.716681f, 0.177208f},
+    {0.994474f, 0.722691f, 0.174381f},
+    {0.994553f, 0.728728f, 0.171622f},
+    {0.994561f, 0.734791f, 0.168938f},
+    {0.994495f, 0.740880f, 0.166335f},
+    {0.994355f, 0.746995f, 0.163821f},
+    {0.994141f, 0.753137f, 0.161404f},
+    {0.993851f, 0.759304f, 0.159092f},
+    {0.993482f, 0.765499f, 0.156891f},
+    {0.993033f, 0.771720f, 0.154808f},
+    {0.992505f, 0.777967f, 0.152855f},
+    {0.991897f, 0.784239f, 0.151042f},
+    {0.991209f, 0.790537f, 0.149377f},
+    {0.990439f, 0.796859f, 0.147870f},
+    {0.989587f, 0.803205f, 0.146529f},
+    {0.988648f, 0.809579f, 0.145357f},
+    {0.987621f, 0.815978f, 0.144363f},
+    {0.986509f, 0.822401f, 0.143557f},
+    {0.985314f, 0.828846f, 0.142945f},
+    {0.984031f, 0.835315f, 0.142528f},
+    {0.982653f, 0.841812f, 0.142303f},
+    {0.981190f, 0.848329f, 0.142279f},
+    {0.979644f, 0.854866f, 0.142453f},
+    {0.977995f, 0.861432f, 0.142808f},
+    {0.976265f, 0.868016f, 0.143351f},
+    {0.974443f, 0.874622f, 0.144061f},
+    {0.972530f, 0.881250f, 0.144923f},
+    {0.970533f, 0.887896f, 0.145919f},
+    {0.968443f, 0.894564f, 0.147014f},
+    {0.966271f, 0.901249f, 0.148180f},
+    {0.964021f, 0.907950f, 0.149370f},
+    {0.961681f, 0.914672f, 0.150520f},
+    {0.959276f, 0.921407f, 0.151566f},
+    {0.956808f, 0.928152f, 0.152409f},
+    {0.954287f, 0.934908f, 0.152921f},
+    {0.951726f, 0.941671f, 0.152925f},
+    {0.949151f, 0.948435f, 0.152178f},
+    {0.946602f, 0.955190f, 0.150328f},
+    {0.944152f, 0.961916f, 0.146861f},
+    {0.941896f, 0.968590f, 0.140956f},
+    {0.940015f, 0.975158f, 0.131326f},
+};
+
+static const std::vector<Colormaps::Color> INFERNO = {
+    {0.001462f, 0.000466f, 0.013866f},
+    {0.002267f, 0.001270f, 0.018570f},
+    {0.003299f, 0.002249f, 0.024239f},
+    {0.004547f, 0.003392f, 0.030909f},
+    {0.006006f, 0.004692f, 0.038558f},
+    {0.007676f, 0.006136f, 0.046836f},
+    {0.009561f, 0.007713f, 0.055143f},
+    {0.011663f, 0.009417f, 0.063460f},
+    {0.013995f, 0.011225f, 0.071862f},
+    {0.016561f, 0.013136f, 0.080282f},
+    {0.019373f, 0.015133f, 0.088767f},
+    {0.022447f, 0.017199f, 0.097327f},
+    {0.025793f, 0.019331f, 0.105930f},
+    {0.029432f, 0.021503f, 0.114621f},
+    {0.033385f, 0.023702f, 0.123397f},
+    {0.037668f, 0.025921f, 0.132232f},
+    {0.042253f, 0.028139f, 0.141141f},
+    {0.046915f, 0.030324f, 0.150164f},
+    {0.051644f, 0.032474f, 0.159254f},
+    {0.056449f, 0.034569f, 0.168414f},
+    {0.061340f, 0.036590f, 0.177642f},
+    {0.066331f, 0.038504f, 0.186962f},
+    {0.071429f, 0.040294f, 0.196354f},
+    {0.076637f, 0.041905f, 0.205799f},
+    {0.081962f, 0.043328f, 0.215289f},
+    {0.087411f, 0.044556f, 0.224813f},
+    {0.092990f, 0.045583f, 0.234358f},
+    {0.098702f, 0.046402f, 0.243904f},
+    {0.104551f, 0.047008f, 0.253430f},
+    {0.110536f, 0.047399f, 0.262912f},
+    {0.116656f, 0.047574f, 0.272321f},
+    {0.122908f, 0.047536f, 0.281624f},
+    {0.129285f, 0.047293f, 0.290788f},
+    {0.135778f, 0.046856f, 0.299776f},
+    {0.142378f, 0.046242f, 0.308553f},
+    {0.149073f, 0.045468f, 0.317085f},
+    {0.155850f, 0.044559f, 0.325338f},
+    {0.162689f, 0.043554f, 0.333277f},
+    {0.169575f, 0.042489f, 0.340874f},
+    {0.176493f, 0.041402f, 0.348111f},
+    {0.183429f, 0.040329f, 0.354971f},
+    {0.190367f, 0.039309f, 0.361447f},
+    {0.197297f, 0.038400f, 0.367535f},
+    {0.204209f, 0.037632f, 0.373238f},
+    {0.211095f, 0.037030f, 0.378563f},
+    {0.217949f, 0.036615f, 0.383522f},
+    {0.224763f, 0.036405f, 0.388129f},
+    {0.231538f, 0.036405f, 0.392400f},
+    {0.238273f, 0.036621f, 0.396353f},
+    {0.244967f, 0.037055f, 0.400007f},
+    {0.251620f, 0.037705f, 0.403378f},
+    {0.258234f, 0.038571f, 0.406485f},
+    {0.264810f, 0.039647f, 0.409345f},
+    {0.271347f, 0.040922f, 0.411976f},
+    {0.277850f, 0.042353f, 0.414392f},
+    {0.284321f, 0.043933f, 0.416608f},
+    {0.290763f, 0.045644f, 0.418637f},
+    {0.297178f, 0.047470f, 0.420491f},
+    {0.303568f, 0.049396f, 0.422182f},
+    {0.309935f, 0.051407f, 0.423721f},
+    {0.316282f, 0.053490f, 0.425116f},
+    {0.322610f, 0.055634f, 0.426377f},
+    {0.328921f, 0.057827f, 0.427511f},
+    {0.335217f, 0.060060f, 0.428524f},
+    {0.341500f, 0.062325f, 0.429425f},
+    {0.347771f, 0.064616f, 0.430217f},
+    {0.354032f, 0.066925f, 0.430906f},
+    {0.360284f, 0.069247f, 0.431497f},
+    {0.366529f, 0.071579f, 0.431994f},
+    {0.372768f, 0.073915f, 0.432400f},
+    {0.379001f, 0.076253f, 0.432719f},
+    {0.385228f, 0.078591f, 0.432955f},
+    {0.391453f, 0.080927f, 0.433109f},
+    {0.397674f, 0.083257f, 0.433183f},
+    {0.403894f, 0.085580f, 0.433179f},
+    {0.410113f, 0.087896f, 0.433098f},
+    {0.416331f, 0.090203f, 0.432943f},
+    {0.422549f, 0.092501f, 0.432714f},
+    {0.428768f, 0.094790f, 0.432412f},
+    {0.434987f, 0.097069f, 0.432039f},
+    {0.441207f, 0.099338f, 0.431594f},
+    {0.447428f, 0.101597f, 0.431080f},
+    {0.453651f, 0.103848f, 0.430498f},
+    {0.459875f, 0.106089f, 0.429846f},
+    {0.466100f, 0.108322f, 0.429125f},
+    {0.472328f, 0.110547f, 0.428334f},
+    {0.478558f, 0.112764f, 0.427475f},
+    {0.484789f, 0.114974f, 0.426548f},
+    {0.491022f, 0.117179f, 0.425552f},
+    {0.497257f, 0.119379f, 0.424488f},
+    {0.503493f, 0.121575f, 0.423356f},
+    {0.509730f, 0.123769f, 0.422156f},
+    {0.515967f, 0.125960f, 0.420887f},
+    {0.522206f, 0.128150f, 0.419549f},
+    {0.528444f, 0.130341f, 0.418142f},
+    {0.534683f, 0.132534f, 0.416667f},
+    {0.540920f, 0.134729f, 0.415123f},
+    {0.547157f, 0.136929f, 0.413511f},
+    {0.553392f, 0.139134f, 0.411829f},
+    {0.559624f, 0.141346f, 0.410078f},
+    {0.565854f, 0.143567f, 0.408258f},
+    {0.572081f, 0.145797f, 0.406369f},
+    {0.578304f, 0.148039f, 0.404411f},
+    {0.584521f, 0.150294f, 0.402385f},
+    {0.590734f, 0.152563f, 0.400290f},
+    {0.596940f, 0.154848f, 0.398125f},
+    {0.603139f, 0.157151f, 0.395891f},
+    {0.609330f, 0.159474f, 0.393589f},
+    {0.615513f, 0.161817f, 0.391219f},
+    {0.621685f, 0.164184f, 0.388781f},
+    {0.627847f, 0.166575f, 0.386276f},
+    {0.633998f, 0.168992f, 0.383704f},
+    {0.640135f, 0.171438f, 0.381065f},
+    {0.646260f, 0.173914f, 0.378359f},
+    {0.652369f, 0.176421f, 0.375586f},
+    {0.658463f, 0.178962f, 0.372748f},
+    {0.664540f, 0.181539f, 0.369846f},
+    {0.670599f, 0.184153f, 0.366879f},
+    {0.676638f, 0.186807f, 0.363849f},
+    {0.682656f, 0.189501f, 0.360757f},
+    {0.688653f, 0.192239f, 0.357603f},
+    {0.694627f, 0.195021f, 0.354388f},
+    {0.700576f, 0.197851f, 0.351113f},
+    {0.706500f, 0.200728f, 0.347777f},
+    {0.712396f, 0.203656f, 0.344383f},
+    {0.718264f, 0.206636f, 0.340931f},
+    {0.724103f, 0.209670f, 0.337424f},
+    {0.729909f, 0.212759f, 0.333861f},
+    {0.735683f, 0.215906f, 0.330245f},
+    {0.741423f, 0.219112f, 0.326576f},
+    {0.747127f, 0.222378f, 0.322856f},
+    {0.752794f, 0.225706f, 0.319085f},
+    {0.758422f, 0.229097f, 0.315266f},
+    {0.764010f, 0.232554f, 0.311399f},
+    {0.769556f, 0.236077f, 0.307485f},
+    {0.775059f, 0.239667f, 0.303526f},
+    {0.780517f, 0.243327f, 0.299523f},
+    {0.785929f, 0.247056f, 0.295477f},
+    {0.791293f, 0.250856f, 0.291390f},
+    {0.796607f, 0.254728f, 0.287264f},
+    {0.801871f, 0.258674f, 0.283099f},
+    {0.807082f, 0.262692f, 0.278898f},
+    {0.812239f, 0.266786f, 0.274661f},
+    {0.817341f, 0.270954f, 0.270390f},
+    {0.822386f, 0.275197f, 0.266085f},
+    {0.827372f, 0.279517f, 0.261750f},
+    {0.832299f, 0.283913f, 0.257383f},
+    {0.837165f, 0.288385f, 0.252988f},
+    {0.841969f, 0.292933f, 0.248564f},
+    {0.846709f, 0.297559f, 0.244113f},
+    {0.851384f, 0.302260f, 0.239636f},
+    {0.855992f, 0.307038f, 0.235133f},
+    {0.860533f, 0.311892f, 0.230606f},
+    {0.865006f, 0.316822f, 0.226055f},
+    {0.869409f, 0.321827f, 0.221482f},
+    {0.873741f, 0.326906f, 0.216886f},
+    {0.878001f, 0.332060f, 0.212268f},
+    {0.882188f, 0.337287f, 0.207628f},
+    {0.886302f, 0.342586f, 0.202968f},
+    {0.890341f, 0.347957f, 0.198286f},
+    {0.894305f, 0.353399f, 0.193584f},
+    {0.898192f, 0.358911f, 0.188860f},
+    {0.902003f, 0.364492f, 0.184116f},
+    {0.905735f, 0.370140f, 0.179350f},
+    {0.909390f, 0.375856f, 0.174563f},
+    {0.912966f, 0.381636f, 0.169755f},
+    {0.916462f, 0.387481f, 0.164924f},
+    {0.919879f, 0.393389f, 0.160070f},
+    {0.923215f, 0.399359f, 0.155193f},
+    {0.926470f, 0.405389f, 0.150292f},
+    {0.929644f, 0.411479f, 0.145367f},
+    {0.932737f, 0.417627f, 0.140417f},
+    {0.935747f, 0.423831f, 0.135440f},
+    {0.938675f, 0.430091f, 0.130438f},
+    {0.941521f, 0.436405f, 0.125409f},
+    {0.944285f, 0.442772f, 0.120354f},
+    {0.946965f, 0.449191f, 0.115272f},
+    {0.949562f, 0.455660f, 0.110164f},
+    {0.952075f, 0.462178f, 0.105031f},
+    {0.954506f, 0.468744f, 0.099874f},
+    {0.956852f, 0.475356f, 0.094695f},
+    {0.959114f, 0.482014f, 0.089499f},
+    {0.961293f, 0.488716f, 0.084289f},
+    {0.963387f, 0.495462f, 0.079073f},
+    {0.965397f, 0.502249f, 0.073859f},
+    {0.967322f, 0.509078f, 0.068659f},
+    {0.969163f, 0.515946f, 0.063488f},
+    {0.970919f, 0.522853f, 0.058367f},
+    {0.972590f, 0.529798f, 0.053324f},
+    {0.974176f, 0.536780f, 0.048392f},
+    {0.975677f, 0.543798f, 0.043618f},
+    {0.977092f, 0.550850f, 0.039050f},
+    {0.978422f, 0.557937f, 0.034931f},
+    {0.979666f, 0.565057f, 0.031409f},
+    {0.980824f, 0.572209f, 0.028508f},
+    {0.981895f, 0.579392f, 0.026250f},
+    {0.982881f, 0.586606f, 0.024661f},
+    {0.983779f, 0.593849f, 0.023770f},
+    {0.984591f, 0.601122f, 0.023606f},
+    {0.985315f, 0.608422f, 0.024202f},
+    {0.985952f, 0.615750f, 0.025592f},
+    {0.986502f, 0.623105f, 0.027814f},
+    {0.986964f, 0.630485f, 0.030908f},
+    {0.987337f, 0.637890f, 0.034916f},
+    {0.987622f, 0.645320f, 0.039886f},
+    {0.987819f, 0.652773f, 0.045581f},
+    {0.987926f, 0.660250f, 0.051750f},
+    {0.987945f, 0.667748f, 0.058329f},
+    {0.987874f, 0.675267f, 0.065257f},
+    {0.987714f, 0.682807f, 0.072489f},
+    {0.987464f, 0.690366f, 0.079990f},
+    {0.987124f, 0.697944f, 0.087731f},
+    {0.986694f, 0.705540f, 0.095694f},
+    {0.986175f, 0.713153f, 0.103863f},
+    {0.985566f, 0.720782f, 0.112229f},
+    {0.984865f, 0.728427f, 0.120785f},
+    {0.984075f, 0.736087f, 0.129527f},
+    {0.983196f, 0.743758f, 0.138453f},
+    {0.982228f, 0.751442f, 0.147565f},
+    {0.981173f, 0.759135f, 0.156863f},
+    {0.980032f, 0.766837f, 0.166353f},
+    {0.978806f, 0.774545f, 0.176037f},
+    {0.977497f, 0.782258f, 0.185923f},
+    {0.976108f, 0.789974f, 0.196018f},
+    {0.974638f, 0.797692f, 0.206332f},
+    {0.973088f, 0.805409f, 0.216877f},
+    {0.971468f, 0.813122f, 0.227658f},
+    {0.969783f, 0.820825f, 0.238686f},
+    {0.968041f, 0.828515f, 0.249972f},
+    {0.966243f, 0.836191f, 0.261534f},
+    {0.964394f, 0.843848f, 0.273391f},
+    {0.962517f, 0.851476f, 0.285546f},
+    {0.960626f, 0.859069f, 0.298010f},
+    {0.958720f, 0.866624f, 0.310820f},
+    {0.956834f, 0.874129f, 0.323974f},
+    {0.954997f, 0.881569f, 0.337475f},
+    {0.953215f, 0.888942f, 0.351369f},
+    {0.951546f, 0.896226f, 0.365627f},
+    {0.950018f, 0.903409f, 0.380271f},
+    {0.948683f, 0.910473f, 0.395289f},
+    {0.947594f, 0.917399f, 0.410665f},
+    {0.946809f, 0.924168f, 0.426373f},
+    {0.946392f, 0.930761f, 0.442367f},
+    {0.946403f, 0.937159f, 0.458592f},
+    {0.946903f, 0.943348f, 0.474970f},
+    {0.947937f, 0.949318f, 0.491426f},
+    {0.949545f, 0.955063f, 0.507860f},
+    {0.951740f, 0.960587f, 0.524203f},
+    {0.954529f, 0.965896f, 0.540361f},
+    {0.957896f, 0.971003f, 0.556275f},
+    {0.961812f, 0.975924f, 0.571925f},
+    {0.966249f, 0.980678f, 0.587206f},
+    {0.971162f, 0.985282f, 0.602154f},
+    {0.976511f, 0.989753f, 0.616760f},
+    {0.982257f, 0.994109f, 0.631017f},
+    {0.988362f, 0.998364f, 0.644924f},
+};
+
+static const std::vector<Colormaps::Color> MAGMA = {
+    {0.001462f, 0.000466f, 0.013866f},
+    {0.002258f, 0.001295f, 0.018331f},
+    {0.003279f, 0.002305f, 0.023708f},
+    {0.004512f, 0.003490f, 0.029965f},
+    {0.005950f, 0.004843f, 0.037130f},
+    {0.007588f, 0.006356f, 0.044973f},
+    {0.009426f, 0.008022f, 0.052844f},
+    {0.011465f, 0.009828f, 0.060750f},
+    {0.013708f, 0.011771f, 0.068667f},
+    {0.016156f, 0.013840f, 0.076603f},
+    {0.018815f, 0.016026f, 0.084584f},
+    {0.021692f, 0.018320f, 0.092610f},
+    {0.024792f, 0.020715f, 0.100676f},
+    {0.028123f, 0.023201f, 0.108787f},
+    {0.031696f, 0.025765f, 0.116965f},
+    {0.035520f, 0.028397f, 0.125209f},
+    {0.039608f, 0.031090f, 0.133515f},
+    {0.043830f, 0.033830f, 0.141886f},
+    {0.048062f, 0.036607f, 0.150327f},
+    {0.052320f, 0.039407f, 0.158841f},
+    {0.056615f, 0.042160f, 0.167446f},
+    {0.060949f, 0.044794f, 0.176129f},
+    {0.065330f, 0.047318f, 0.184892f},
+    {0.069764f, 0.049726f, 0.193735f},
+    {0.074257f, 0.052017f, 0.202660f},
+    {0.078815f, 0.054184f, 0.211667f},
+    {0.083446f, 0.056225f, 0.220755f},
+    {0.088155f, 0.058133f, 0.229922f},
+    {0.092949f, 0.059904f, 0.239164f},
+    {0.097833f, 0.061531f, 0.248477f},
+    {0.102815f, 0.063010f, 0.257854f},
+    {0.107899f, 0.064335f, 0.267289f},
+    {0.113094f, 0.065492f, 0.276784f},
+    {0.118405f, 0.066479f, 0.286321f},
+    {0.123833f, 0.067295f, 0.295879f},
+    {0.129380f, 0.067935f, 0.305443f},
+    {0.135053f, 0.068391f, 0.315000f},
+    {0.140858f, 0.068654f, 0.324538f},
+    {0.146785f, 0.068738f, 0.334011f},
+    {0.152839f, 0.068637f, 0.343404f},
+    {0.159018f, 0.068354f, 0.352688f},
+    {0.165308f, 0.067911f, 0.361816f},
+    {0.171713f, 0.067305f, 0.370771f},
+    {0.178212f, 0.066576f, 0.379497f},
+    {0.184801f, 0.065732f, 0.387973f},
+    {0.191460f, 0.064818f, 0.396152f},
+    {0.198177f, 0.063862f, 0.404009f},
+    {0.204935f, 0.062907f, 0.411514f},
+    {0.211718f, 0.061992f, 0.418647f},
+    {0.218512f, 0.061158f, 0.425392f},
+    {0.225302f, 0.060445f, 0.431742f},
+    {0.232077f, 0.059889f, 0.437695f},
+    {0.238826f, 0.059517f, 0.443256f},
+    {0.245543f, 0.059352f, 0.448436f},
+    {0.252220f, 0.059415f, 0.453248f},
+    {0.258857f, 0.059706f, 0.457710f},
+    {0.265447f, 0.060237f, 0.461840f},
+    {0.271994f, 0.060994f, 0.465660f},
+    {0.278493f, 0.061978f, 0.469190f},
+    {0.284951f, 0.063168f, 0.472451f},
+    {0.291366f, 0.064553f, 0.475462f},
+    {0.297740f, 0.066117f, 0.478243f},
+    {0.304081f, 0.067835f, 0.480812f},
+    {0.310382f, 0.069702f, 0.483186f},
+    {0.316654f, 0.071690f, 0.485380f},
+    {0.322899f, 0.073782f, 0.487408f},
+    {0.329114f, 0.075972f, 0.489287f},
+    {0.335308f, 0.078236f, 0.491024f},
+    {0.341482f, 0.080564f, 0.492631f},
+    {0.347636f, 0.082946f, 0.494121f},
+    {0.353773f, 0.085373f, 0.495501f},
+    {0.359898f, 0.087831f, 0.496778f},
+    {0.366012f, 0.090314f, 0.497960f},
+    {0.372116f, 0.092816f, 0.499053f},
+    {0.378211f, 0.095332f, 0.500067f},
+    {0.384299f, 0.097855f, 0.501002f},
+    {0.390384f, 0.100379f, 0.501864f},
+    {0.396467f, 0.102902f, 0.502658f},
+    {0.402548f, 0.105420f, 0.503386f},
+    {0.408629f, 0.107930f, 0.504052f},
+    {0.414709f, 0.110431f, 0.504662f},
+    {0.420791f, 0.112920f, 0.505215f},
+    {0.426877f, 0.115395f, 0.505714f},
+    {0.432967f, 0.117855f, 0.506160f},
+    {0.439062f, 0.120298f, 0.506555f},
+    {0.445163f, 0.122724f, 0.506901f},
+    {0.451271f, 0.125132f, 0.507198f},
+    {0.457386f, 0.127522f, 0.507448f},
+    {0.463508f, 0.129893f, 0.507652f},
+    {0.469640f, 0.132245f, 0.507809f},
+    {0.475780f, 0.134577f, 0.507921f},
+    {0.481929f, 0.136891f, 0.507989f},
+    {0.488088f, 0.139186f, 0.508011f},
+    {0.494258f, 0.141462f, 0.507988f},
+    {0.500438f, 0.143719f, 0.507920f},
+    {0.506629f, 0.145958f, 0.507806f},
+    {0.512831f, 0.148179f, 0.507648f},
+    {0.519045f, 0.150383f, 0.507443f},
+    {0.525270f, 0.152569f, 0.507192f},
+    {0.531507f, 0.154739f, 0.506895f},
+    {0.537755f, 0.156894f, 0.506551f},
+    {0.544015f, 0.159033f, 0.506159f},
+    {0.550287f, 0.161158f, 0.505719f},
+    {0.556571f, 0.163269f, 0.505230f},
+    {0.562866f, 0.165368f, 0.504692f},
+    {0.569172f, 0.167454f, 0.504105f},
+    {0.575490f, 0.169530f, 0.503466f},
+    {0.581819f, 0.171596f, 0.502777f},
+    {0.588158f, 0.173652f, 0.502035f},
+    {0.594508f, 0.175701f, 0.501241f},
+    {0.600868f, 0.177743f, 0.500394f},
+    {0.607238f, 0.179779f, 0.499492f},
+    {0.613617f, 0.181811f, 0.498536f},
+    {0.620005f, 0.183840f, 0.497524f},
+    {0.626401f, 0.185867f, 0.496456f},
+    {0.632805f, 0.187893f, 0.495332f},
+    {0.639216f, 0.189921f, 0.494150f},
+    {0.645633f, 0.191952f, 0.492910f},
+    {0.652056f, 0.193986f, 0.491611f},
+    {0.658483f, 0.196027f, 0.490253f},
+    {0.664915f, 0.198075f, 0.488836f},
+    {0.671349f, 0.200133f, 0.487358f},
+    {0.677786f, 0.202203f, 0.485819f},
+    {0.684224f, 0.204286f, 0.484219f},
+    {0.690661f, 0.206384f, 0.482558f},
+    {0.697098f, 0.208501f, 0.480835f},
+    {0.703532f, 0.210638f, 0.479049f},
+    {0.709962f, 0.212797f, 0.477201f},
+    {0.716387f, 0.214982f, 0.475290f},
+    {0.722805f, 0.217194f, 0.473316f},
+    {0.729216f, 0.219437f, 0.471279f},
+    {0.735616f, 0.221713f, 0.469180f},
+    {0.742004f, 0.224025f, 0.467018f},
+    {0.748378f, 0.226377f, 0.464794f},
+    {0.754737f, 0.228772f, 0.462509f},
+    {0.761077f, 0.231214f, 0.460162f},
+    {0.767398f, 0.233705f, 0.457755f},
+    {0.773695f, 0.236249f, 0.455289f},
+    {0.779968f, 0.238851f, 0.452765f},
+    {0.786212f, 0.241514f, 0.450184f},
+    {0.792427f, 0.244242f, 0.447543f},
+    {0.798608f, 0.247040f, 0.444848f},
+    {0.804752f, 0.249911f, 0.442102f},
+    {0.810855f, 0.252861f, 0.439305f},
+    {0.816914f, 0.255895f, 0.436461f},
+    {0.822926f, 0.259016f, 0.433573f},
+    {0.828886f, 0.262229f, 0.430644f},
+    {0.834791f, 0.265540f, 0.427671f},
+    {0.840636f, 0.268953f, 0.424666f},
+    {0.846416f, 0.272473f, 0.421631f},
+    {0.852126f, 0.276106f, 0.418573f},
+    {0.857763f, 0.279857f, 0.415496f},
+    {0.863320f, 0.283729f, 0.412403f},
+    {0.868793f, 0.287728f, 0.409303f},
+    {0.874176f, 0.291859f, 0.406205f},
+    {0.879464f, 0.296125f, 0.403118f},
+    {0.884651f, 0.300530f, 0.400047f},
+    {0.889731f, 0.305079f, 0.397002f},
+    {0.894700f, 0.309773f, 0.393995f},
+    {0.899552f, 0.314616f, 0.391037f},
+    {0.904281f, 0.319610f, 0.388137f},
+    {0.908884f, 0.324755f, 0.385308f},
+    {0.913354f, 0.330052f, 0.382563f},
+    {0.917689f, 0.335500f, 0.379915f},
+    {0.921884f, 0.341098f, 0.377376f},
+    {0.925937f, 0.346844f, 0.374959f},
+    {0.929845f, 0.352734f, 0.372677f},
+    {0.933606f, 0.358764f, 0.370541f},
+    {0.937221f, 0.364929f, 0.368567f},
+    {0.940687f, 0.371224f, 0.366762f},
+    {0.944006f, 0.377643f, 0.365136f},
+    {0.947180f, 0.384178f, 0.363701f},
+    {0.950210f, 0.390820f, 0.362468f},
+    {0.953099f, 0.397563f, 0.361438f},
+    {0.955849f, 0.404400f, 0.360619f},
+    {0.958464f, 0.411324f, 0.360014f},
+    {0.960949f, 0.418323f, 0.359630f},
+    {0.963310f, 0.425390f, 0.359469f},
+    {0.965549f, 0.432519f, 0.359529f},
+    {0.967671f, 0.439703f, 0.359810f},
+    {0.969680f, 0.446936f, 0.360311f},
+    {0.971582f, 0.454210f, 0.361030f},
+    {0.973381f, 0.461520f, 0.361965f},
+    {0.975082f, 0.468861f, 0.363111f},
+    {0.976690f, 0.476226f, 0.364466f},
+    {0.978210f, 0.483612f, 0.366025f},
+    {0.979645f, 0.491014f, 0.367783f},
+    {0.981000f, 0.498428f, 0.369734f},
+    {0.982279f, 0.505851f, 0.371874f},
+    {0.983485f, 0.513280f, 0.374198f},
+    {0.984622f, 0.520713f, 0.376698f},
+    {0.985693f, 0.528148f, 0.379371f},
+    {0.986700f, 0.535582f, 0.382210f},
+    {0.987646f, 0.543015f, 0.385210f},
+    {0.988533f, 0.550446f, 0.388365f},
+    {0.989363f, 0.557873f, 0.391671f},
+    {0.990138f, 0.565296f, 0.395122f},
+    {0.990871f, 0.572706f, 0.398714f},
+    {0.991558f, 0.580107f, 0.402441f},
+    {0.992196f, 0.587502f, 0.406299f},
+    {0.992785f, 0.594891f, 0.410283f},
+    {0.993326f, 0.602275f, 0.414390f},
+    {0.993834f, 0.609644f, 0.418613f},
+    {0.994309f, 0.616999f, 0.422950f},
+    {0.994738f, 0.624350f, 0.427397f},
+    {0.995122f, 0.631696f, 0.431951f},
+    {0.995480f, 0.639027f, 0.436607f},
+    {0.995810f, 0.646344f, 0.441361f},
+    {0.996096f, 0.653659f, 0.446213f},
+    {0.996341f, 0.660969f, 0.451160f},
+    {0.996580f, 0.668256f, 0.456192f},
+    {0.996775f, 0.675541f, 0.461314f},
+    {0.996925f, 0.682828f, 0.466526f},
+    {0.997077f, 0.690088f, 0.471811f},
+    {0.997186f, 0.697349f, 0.477182f},
+    {0.997254f, 0.704611f, 0.482635f},
+    {0.997325f, 0.711848f, 0.488154f},
+    {0.997351f, 0.719089f, 0.493755f},
+    {0.997351f, 0.726324f, 0.499428f},
+    {0.997341f, 0.733545f, 0.505167f},
+    {0.997285f, 0.740772f, 0.510983f},
+    {0.997228f, 0.747981f, 0.516859f},
+    {0.997138f, 0.755190f, 0.522806f},
+    {0.997019f, 0.762398f, 0.528821f},
+    {0.996898f, 0.769591f, 0.534892f},
+    {0.996727f, 0.776795f, 0.541039f},
+    {0.996571f, 0.783977f, 0.547233f},
+    {0.996369f, 0.791167f, 0.553499f},
+    {0.996162f, 0.798348f, 0.559820f},
+    {0.995932f, 0.805527f, 0.566202f},
+    {0.995680f, 0.812706f, 0.572645f},
+    {0.995424f, 0.819875f, 0.579140f},
+    {0.995131f, 0.827052f, 0.585701f},
+    {0.994851f, 0.834213f, 0.592307f},
+    {0.994524f, 0.841387f, 0.598983f},
+    {0.994222f, 0.848540f, 0.605696f},
+    {0.993866f, 0.855711f, 0.612482f},
+    {0.993545f, 0.862859f, 0.619299f},
+    {0.993170f, 0.870024f, 0.626189f},
+    {0.992831f, 0.877168f, 0.633109f},
+    {0.992440f, 0.884330f, 0.640099f},
+    {0.992089f, 0.891470f, 0.647116f},
+    {0.991688f, 0.898627f, 0.654202f},
+    {0.991332f, 0.905763f, 0.661309f},
+    {0.990930f, 0.912915f, 0.668481f},
+    {0.990570f, 0.920049f, 0.675675f},
+    {0.990175f, 0.927196f, 0.682926f},
+    {0.989815f, 0.934329f, 0.690198f},
+    {0.989434f, 0.941470f, 0.697519f},
+    {0.989077f, 0.948604f, 0.704863f},
+    {0.988717f, 0.955742f, 0.712242f},
+    {0.988367f, 0.962878f, 0.719649f},
+    {0.988033f, 0.970012f, 0.727077f},
+    {0.987691f, 0.977154f, 0.734536f},
+    {0.987387f, 0.984288f, 0.742002f},
+    {0.987053f, 0.991438f, 0.749504f},
+};
+
+static const std::vector<Colormaps::Color> GIST_EARTH = {
+    {0.000000f, 0.000000f, 0.000000f},
+    {0.002613f, 0.000000f, 0.168692f},
+    {0.005227f, 0.000000f, 0.221664f},
+    {0.007840f, 0.000000f, 0.263805f},
+    {0.010454f, 0.000000f, 0.305947f},
+    {0.013067f, 0.000000f, 0.348089f},
+    {0.015681f, 0.000000f, 0.390231f},
+    {0.018294f, 0.000000f, 0.432373f},
+    {0.020908f, 0.008907f, 0.454745f},
+    {0.023521f, 0.017927f, 0.455606f},
+    {0.026135f, 0.026948f, 0.456317f},
+    {0.028748f, 0.035968f, 0.457028f},
+    {0.031361f, 0.044988f, 0.457739f},
+    {0.033975f, 0.054008f, 0.458449f},
+    {0.036588f, 0.063028f, 0.459160f},
+    {0.039202f, 0.072048f, 0.459871f},
+    {0.041815f, 0.081068f, 0.460582f},
+    {0.044429f, 0.090088f, 0.461293f},
+    {0.047042f, 0.099108f, 0.462004f},
+    {0.049656f, 0.108128f, 0.462715f},
+    {0.052269f, 0.117148f, 0.463426f},
+    {0.054883f, 0.126168f, 0.464136f},
+    {0.057496f, 0.135189f, 0.464847f},
+    {0.060109f, 0.144209f, 0.465558f},
+    {0.062723f, 0.153229f, 0.466269f},
+    {0.065336f, 0.162249f, 0.466980f},
+    {0.067950f, 0.171269f, 0.467691f},
+    {0.070563f, 0.180289f, 0.468402f},
+    {0.073177f, 0.189308f, 0.469113f},
+    {0.075790f, 0.197466f, 0.469824f},
+    {0.078404f, 0.205623f, 0.470534f},
+    {0.081017f, 0.213780f, 0.471245f},
+    {0.083631f, 0.221938f, 0.471956f},
+    {0.086244f, 0.230095f, 0.472667f},
+    {0.088857f, 0.238253f, 0.473378f},
+    {0.091471f, 0.246410f, 0.474089f},
+    {0.094084f, 0.254568f, 0.474800f},
+    {0.096698f, 0.262725f, 0.475511f},
+    {0.099311f, 0.270882f, 0.476221f},
+    {0.101925f, 0.279040f, 0.476932f},
+    {0.104538f, 0.287197f, 0.477643f},
+    {0.107152f, 0.295355f, 0.478354f},
+    {0.109765f, 0.303511f, 0.479065f},
+    {0.112378f, 0.310845f, 0.479776f},
+    {0.114992f, 0.318178f, 0.480487f},
+    {0.117605f, 0.325512f, 0.481198f},
+    {0.120219f, 0.332845f, 0.481909f},
+    {0.122832f, 0.340179f, 0.482619f},
+    {0.125446f, 0.347513f, 0.483330f},
+    {0.128059f, 0.354846f, 0.484041f},
+    {0.130673f, 0.362180f, 0.484752f},
+    {0.133286f, 0.369513f, 0.485463f},
+    {0.135900f, 0.376847f, 0.486174f},
+    {0.138513f, 0.384168f, 0.486885f},
+    {0.141126f, 0.390366f, 0.487596f},
+    {0.143740f, 0.396564f, 0.488306f},
+    {0.146353f, 0.402761f, 0.489017f},
+    {0.148967f, 0.408959f, 0.489728f},
+    {0.151580f, 0.415157f, 0.490439f},
+    {0.154194f, 0.421355f, 0.491150f},
+    {0.156807f, 0.427552f, 0.491861f},
+    {0.159421f, 0.433750f, 0.492572f},
+    {0.162034f, 0.439948f, 0.493283f},
+    {0.164648f, 0.446146f, 0.493994f},
+    {0.167261f, 0.452344f, 0.494704f},
+    {0.169874f, 0.458541f, 0.495415f},
+    {0.172488f, 0.464739f, 0.496126f},
+    {0.175101f, 0.470937f, 0.496837f},
+    {0.177715f, 0.477135f, 0.497548f},
+    {0.180328f, 0.483332f, 0.498259f},
+    {0.182942f, 0.489530f, 0.498970f},
+    {0.185555f, 0.495728f, 0.499681f},
+    {0.188169f, 0.501926f, 0.500391f},
+    {0.190027f, 0.504230f, 0.495657f},
+    {0.191877f, 0.506488f, 0.490857f},
+    {0.193727f, 0.508745f, 0.486057f},
+    {0.195576f, 0.511003f, 0.481256f},
+    {0.197426f, 0.513261f, 0.476456f},
+    {0.199276f, 0.515518f, 0.471655f},
+    {0.201125f, 0.517776f, 0.466855f},
+    {0.202975f, 0.520033f, 0.462055f},
+    {0.204824f, 0.522291f, 0.457254f},
+    {0.206674f, 0.524548f, 0.452454f},
+    {0.208524f, 0.526806f, 0.447654f},
+    {0.210373f, 0.529063f, 0.442853f},
+    {0.212223f, 0.531321f, 0.438053f},
+    {0.214073f, 0.533578f, 0.433253f},
+    {0.215922f, 0.535836f, 0.428452f},
+    {0.217772f, 0.538093f, 0.423652f},
+    {0.219621f, 0.540351f, 0.418852f},
+    {0.221471f, 0.542608f, 0.414051f},
+    {0.223321f, 0.544866f, 0.409251f},
+    {0.225170f, 0.547123f, 0.404450f},
+    {0.227020f, 0.549381f, 0.399650f},
+    {0.228870f, 0.551638f, 0.394850f},
+    {0.230719f, 0.553896f, 0.390049f},
+    {0.232569f, 0.556154f, 0.385249f},
+    {0.234419f, 0.558411f, 0.380449f},
+    {0.236268f, 0.560669f, 0.375648f},
+    {0.238118f, 0.562926f, 0.370848f},
+    {0.239967f, 0.565184f, 0.366048f},
+    {0.241817f, 0.567441f, 0.361247f},
+    {0.243667f, 0.569699f, 0.356447f},
+    {0.245516f, 0.571956f, 0.351647f},
+    {0.247366f, 0.574214f, 0.346846f},
+    {0.249216f, 0.576471f, 0.342046f},
+    {0.251065f, 0.578729f, 0.337245f},
+    {0.252915f, 0.580986f, 0.332445f},
+    {0.254764f, 0.583244f, 0.327645f},
+    {0.256614f, 0.585501f, 0.322844f},
+    {0.258464f, 0.587759f, 0.318044f},
+    {0.260313f, 0.590016f, 0.313244f},
+    {0.262163f, 0.592274f, 0.308443f},
+    {0.264013f, 0.594531f, 0.303643f},
+    {0.265862f, 0.596789f, 0.298843f},
+    {0.267712f, 0.599046f, 0.294042f},
+    {0.269561f, 0.601304f, 0.289242f},
+    {0.271452f, 0.603562f, 0.284442f},
+    {0.280169f, 0.605819f, 0.279641f},
+    {0.288886f, 0.608077f, 0.274841f},
+    {0.297603f, 0.610334f, 0.277066f},
+    {0.306320f, 0.612592f, 0.279352f},
+    {0.315037f, 0.614849f, 0.281638f},
+    {0.323754f, 0.617107f, 0.283924f},
+    {0.332471f, 0.619364f, 0.286210f},
+    {0.341188f, 0.621622f, 0.288496f},
+    {0.349905f, 0.623879f, 0.290782f},
+    {0.358622f, 0.626137f, 0.293068f},
+    {0.367339f, 0.628394f, 0.295354f},
+    {0.376056f, 0.630652f, 0.297640f},
+    {0.384773f, 0.632909f, 0.299926f},
+    {0.393490f, 0.635167f, 0.302212f},
+    {0.402207f, 0.637424f, 0.304497f},
+    {0.410924f, 0.639682f, 0.306783f},
+    {0.419642f, 0.641407f, 0.309069f},
+    {0.428359f, 0.643128f, 0.311355f},
+    {0.437076f, 0.644848f, 0.313641f},
+    {0.445793f, 0.646569f, 0.315927f},
+    {0.454510f, 0.648290f, 0.318213f},
+    {0.463227f, 0.650010f, 0.320499f},
+    {0.471932f, 0.651731f, 0.321739f},
+    {0.478399f, 0.653452f, 0.322978f},
+    {0.484866f, 0.655172f, 0.324218f},
+    {0.491332f, 0.656893f, 0.325457f},
+    {0.497799f, 0.658614f, 0.326697f},
+    {0.504266f, 0.660334f, 0.327936f},
+    {0.510732f, 0.662055f, 0.329175f},
+    {0.517199f, 0.663776f, 0.330415f},
+    {0.523665f, 0.665497f, 0.331654f},
+    {0.530132f, 0.667217f, 0.332894f},
+    {0.536599f, 0.668938f, 0.334133f},
+    {0.543065f, 0.670659f, 0.335372f},
+    {0.549532f, 0.672379f, 0.336612f},
+    {0.555999f, 0.674100f, 0.337851f},
+    {0.562465f, 0.675821f, 0.339091f},
+    {0.568932f, 0.677541f, 0.340330f},
+    {0.575399f, 0.679262f, 0.341570f},
+    {0.581865f, 0.680983f, 0.342809f},
+    {0.588332f, 0.682703f, 0.344048f},
+    {0.594798f, 0.684424f, 0.345288f},
+    {0.601265f, 0.686145f, 0.346527f},
+    {0.607732f, 0.687866f, 0.347767f},
+    {0.614198f, 0.689586f, 0.349006f},
+    {0.620665f, 0.691307f, 0.350246f},
+    {0.627132f, 0.693028f, 0.351485f},
+    {0.633598f, 0.694748f, 0.352724f},
+    {0.640065f, 0.696469f, 0.353964f},
+    {0.646532f, 0.698190f, 0.355203f},
+    {0.652998f, 0.699910f, 0.356443f},
+    {0.659465f, 0.701631f, 0.357682f},
+    {0.665932f, 0.703352f, 0.358922f},
+    {0.672398f, 0.705072f, 0.360161f},
+    {0.678865f, 0.706793f, 0.361400f},
+    {0.685331f, 0.708514f, 0.362640f},
+    {0.691798f, 0.710234f, 0.363879f},
+    {0.698265f, 0.711955f, 0.365119f},
+    {0.704731f, 0.713676f, 0.366358f},
+    {0.711198f, 0.715397f, 0.367598f},
+    {0.717616f, 0.717066f, 0.368837f},
+    {0.719255f, 0.713679f, 0.370076f},
+    {0.720895f, 0.710293f, 0.371316f},
+    {0.722534f, 0.706906f, 0.372555f},
+    {0.724173f, 0.703519f, 0.373795f},
+    {0.725812f, 0.700132f, 0.375034f},
+    {0.727451f, 0.696745f, 0.376274f},
+    {0.729090f, 0.693358f, 0.377513f},
+    {0.730729f, 0.689972f, 0.378752f},
+    {0.732368f, 0.686585f, 0.379992f},
+    {0.734007f, 0.683198f, 0.381231f},
+    {0.735646f, 0.679811f, 0.382471f},
+    {0.737285f, 0.676424f, 0.383710f},
+    {0.738924f, 0.673038f, 0.384950f},
+    {0.740563f, 0.669651f, 0.386189f},
+    {0.742202f, 0.666264f, 0.387428f},
+    {0.743841f, 0.662877f, 0.388668f},
+    {0.745480f, 0.659490f, 0.389907f},
+    {0.747119f, 0.656104f, 0.391147f},
+    {0.748759f, 0.652717f, 0.392386f},
+    {0.750398f, 0.649330f, 0.393625f},
+    {0.752037f, 0.645943f, 0.394865f},
+    {0.753676f, 0.642556f, 0.396134f},
+    {0.755339f, 0.639219f, 0.405741f},
+    {0.759726f, 0.641277f, 0.415349f},
+    {0.764112f, 0.642991f, 0.424956f},
+    {0.768498f, 0.644700f, 0.434564f},
+    {0.772885f, 0.646409f, 0.444171f},
+    {0.777271f, 0.648137f, 0.453779f},
+    {0.781657f, 0.651513f, 0.463386f},
+    {0.786044f, 0.654888f, 0.472994f},
+    {0.790430f, 0.658287f, 0.482601f},
+    {0.794816f, 0.661685f, 0.492208f},
+    {0.799203f, 0.665084f, 0.501816f},
+    {0.803589f, 0.668483f, 0.511423f},
+    {0.807975f, 0.671882f, 0.521031f},
+    {0.812361f, 0.675280f, 0.530638f},
+    {0.816748f, 0.678679f, 0.540246f},
+    {0.821134f, 0.682078f, 0.549853f},
+    {0.825520f, 0.685476f, 0.559461f},
+    {0.829907f, 0.688875f, 0.569068f},
+    {0.834293f, 0.692274f, 0.578676f},
+    {0.838679f, 0.695672f, 0.588283f},
+    {0.843066f, 0.699071f, 0.597891f},
+    {0.847452f, 0.704683f, 0.607498f},
+    {0.851838f, 0.710314f, 0.617106f},
+    {0.856225f, 0.715923f, 0.626713f},
+    {0.860611f, 0.721533f, 0.636321f},
+    {0.864997f, 0.726915f, 0.645928f},
+    {0.869383f, 0.732295f, 0.655536f},
+    {0.873770f, 0.737674f, 0.665153f},
+    {0.878156f, 0.743077f, 0.676973f},
+    {0.882542f, 0.750747f, 0.688794f},
+    {0.886929f, 0.758418f, 0.700614f},
+    {0.891315f, 0.766089f, 0.712434f},
+    {0.895701f, 0.773759f, 0.724254f},
+    {0.900088f, 0.781430f, 0.736075f},
+    {0.904474f, 0.789101f, 0.747895f},
+    {0.908860f, 0.796771f, 0.759715f},
+    {0.913246f, 0.804442f, 0.771535f},
+    {0.917633f, 0.812113f, 0.783356f},
+    {0.922019f, 0.819783f, 0.795176f},
+    {0.926405f, 0.827454f, 0.806996f},
+    {0.930792f, 0.836438f, 0.818816f},
+    {0.935178f, 0.845430f, 0.830637f},
+    {0.939564f, 0.854422f, 0.842457f},
+    {0.943951f, 0.863415f, 0.854277f},
+    {0.948337f, 0.872514f, 0.866097f},
+    {0.952723f, 0.881617f, 0.877918f},
+    {0.957110f, 0.893070f, 0.889738f},
+    {0.961496f, 0.904522f, 0.901558f},
+    {0.965882f, 0.915975f, 0.913378f},
+    {0.970268f, 0.927427f, 0.925199f},
+    {0.974655f, 0.938880f, 0.937019f},
+    {0.979041f, 0.950332f, 0.948839f},
+    {0.983427f, 0.961785f, 0.960659f},
+    {0.987814f, 0.973237f, 0.972480f},
+    {0.992200f, 0.984300f, 0.984300f},
+};
+
+static const std::vector<Colormaps::Color> TERRAIN = {
+    {0.200000f, 0.200000f, 0.600000f},
+    {0.194771f, 0.210458f, 0.610458f},
+    {0.189542f, 0.220915f, 0.620915f},
+    {0.184314f, 0.231373f, 0.631373f},
+    {0.179085f, 0.241830f, 0.641830f},
+    {0.173856f, 0.252288f, 0.652288f},
+    {0.168627f, 0.262745f, 0.662745f},
+    {0.163399f, 0.273203f, 0.673203f},
+    {0.158170f, 0.283660f, 0.683660f},
+    {0.152941f, 0.294118f, 0.694118f},
+    {0.147712f, 0.304575f, 0.704575f},
+    {0.142484f, 0.315033f, 0.715033f},
+    {0.137255f, 0.325490f, 0.725490f},
+    {0.132026f, 0.335948f, 0.735948f},
+    {0.126797f, 0.346405f, 0.746405f},
+    {0.121569f, 0.356863f, 0.756863f},
+    {0.116340f, 0.367320f, 0.767320f},
+    {0.111111f, 0.377778f, 0.777778f},
+    {0.105882f, 0.388235f, 0.788235f},
+    {0.100654f, 0.398693f, 0.798693f},
+    {0.095425f, 0.409150f, 0.809150f},
+    {0.090196f, 0.419608f, 0.819608f},
+    {0.084967f, 0.430065f, 0.830065f},
+    {0.079739f, 0.440523f, 0.840523f},
+    {0.074510f, 0.450980f, 0.850980f},
+    {0.069281f, 0.461438f, 0.861438f},
+    {0.064052f, 0.471895f, 0.871895f},
+    {0.058824f, 0.482353f, 0.882353f},
+    {0.053595f, 0.492810f, 0.892810f},
+    {0.048366f, 0.503268f, 0.903268f},
+    {0.043137f, 0.513725f, 0.913725f},
+    {0.037908f, 0.524183f, 0.924183f},
+    {0.032680f, 0.534641f, 0.934641f},
+    {0.027451f, 0.545098f, 0.945098f},
+    {0.022222f, 0.555556f, 0.955556f},
+    {0.016993f, 0.566013f, 0.966013f},
+    {0.011765f, 0.576471f, 0.976471f},
+    {0.006536f, 0.586928f, 0.986928f},
+    {0.001307f, 0.597386f, 0.997386f},
+    {0.000000f, 0.605882f, 0.982353f},
+    {0.000000f, 0.613725f, 0.958824f},
+    {0.000000f, 0.621569f, 0.935294f},
+    {0.000000f, 0.629412f, 0.911765f},
+    {0.000000f, 0.637255f, 0.888235f},
+    {0.000000f, 0.645098f, 0.864706f},
+    {0.000000f, 0.652941f, 0.841176f},
+    {0.000000f, 0.660784f, 0.817647f},
+    {0.000000f, 0.668627f, 0.794118f},
+    {0.000000f, 0.676471f, 0.770588f},
+    {0.000000f, 0.684314f, 0.747059f},
+    {0.000000f, 0.692157f, 0.723529f},
+    {0.000000f, 0.700000f, 0.700000f},
+    {0.000000f, 0.707843f, 0.676471f},
+    {0.000000f, 0.715686f, 0.652941f},
+    {0.000000f, 0.723529f, 0.629412f},
+    {0.000000f, 0.731373f, 0.605882f},
+    {0.000000f, 0.739216f, 0.582353f},
+    {0.000000f, 0.747059f, 0.558824f},
+    {0.000000f, 0.754902f, 0.535294f},
+    {0.000000f, 0.762745f, 0.511765f},
+    {0.000000f, 0.770588f, 0.488235f},
+    {0.000000f, 0.778431f, 0.464706f},
+    {0.000000f, 0.786275f, 0.441176f},
+    {0.000000f, 0.794118f, 0.417647f},
+    {0.003922f, 0.800784f, 0.400784f},
+    {0.019608f, 0.803922f, 0.403922f},
+    {0.035294f, 0.807059f, 0.407059f},
+    {0.050980f, 0.810196f, 0.410196f},
+    {0.066667f, 0.813333f, 0.413333f},
+    {0.082353f, 0.816471f, 0.416471f},
+    {0.098039f, 0.819608f, 0.419608f},
+    {0.113725f, 0.822745f, 0.422745f},
+    {0.129412f, 0.825882f, 0.425882f},
+    {0.145098f, 0.829020f, 0.429020f},
+    {0.160784f, 0.832157f, 0.432157f},
+    {0.176471f, 0.835294f, 0.435294f},
+    {0.192157f, 0.838431f, 0.438431f},
+    {0.207843f, 0.841569f, 0.441569f},
+    {0.223529f, 0.844706f, 0.444706f},
+    {0.239216f, 0.847843f, 0.447843f},
+    {0.254902f, 0.850980f, 0.450980f},
+    {0.270588f, 0.854118f, 0.454118f},
+    {0.286275f, 0.857255f, 0.457255f},
+    {0.301961f, 0.860392f, 0.460392f},
+    {0.317647f, 0.863529f, 0.463529f},
+    {0.333333f, 0.866667f, 0.466667f},
+    {0.349020f, 0.869804f, 0.469804f},
+    {0.364706f, 0.872941f, 0.472941f},
+    {0.380392f, 0.876078f, 0.476078f},
+    {0.396078f, 0.879216f, 0.479216f},
+    {0.411765f, 0.882353f, 0.482353f},
+    {0.427451f, 0.885490f, 0.485490f},
+    {0.443137f, 0.888627f, 0.488627f},
+    {0.458824f, 0.891765f, 0.491765f},
+    {0.474510f, 0.894902f, 0.494902f},
+    {0.490196f, 0.898039f, 0.498039f},
+    {0.505882f, 0.901176f, 0.501176f},
+    {0.521569f, 0.904314f, 0.504314f},
+    {0.537255f, 0.907451f, 0.507451f},
+    {0.552941f, 0.910588f, 0.510588f},
+    {0.568627f, 0.913725f, 0.513725f},
+    {0.584314f, 0.916863f, 0.516863f},
+    {0.600000f, 0.920000f, 0.520000f},
+    {0.615686f, 0.923137f, 0.523137f},
+    {0.631373f, 0.926275f, 0.526275f},
+    {0.647059f, 0.929412f, 0.529412f},
+    {0.662745f, 0.932549f, 0.532549f},
+    {0.678431f, 0.935686f, 0.535686f},
+    {0.694118f, 0.938824f, 0.538824f},
+    {0.709804f, 0.941961f, 0.541961f},
+    {0.725490f, 0.945098f, 0.545098f},
+    {0.741176f, 0.948235f, 0.548235f},
+    {0.756863f, 0.951373f, 0.551373f},
+    {0.772549f, 0.954510f, 0.554510f},
+    {0.788235f, 0.957647f, 0.557647f},
+    {0.803922f, 0.960784f, 0.560784f},
+    {0.819608f, 0.963922f, 0.563922f},
+    {0.835294f, 0.967059f, 0.567059f},
+    {0.850980f, 0.970196f, 0.570196f},
+    {0.866667f, 0.973333f, 0.573333f},
+    {0.882353f, 0.976471f, 0.576471f},
+    {0.898039f, 0.979608f, 0.579608f},
+    {0.913725f, 0.982745f, 0.582745f},
+    {0.929412f, 0.985882f, 0.585882f},
+    {0.945098f, 0.989020f, 0.589020f},
+    {0.960784f, 0.992157f, 0.592157f},
+    {0.976471f, 0.995294f, 0.595294f},
+    {0.992157f, 0.998431f, 0.598431f},
+    {0.996078f, 0.994980f, 0.597882f},
+    {0.988235f, 0.984941f, 0.593647f},
+    {0.980392f, 0.974902f, 0.589412f},
+    {0.972549f, 0.964863f, 0.585176f},
+    {0.964706f, 0.954824f, 0.580941f},
+    {0.956863f, 0.944784f, 0.576706f},
+    {0.949020f, 0.934745f, 0.572471f},
+    {0.941176f, 0.924706f, 0.568235f},
+    {0.933333f, 0.914667f, 0.564000f},
+    {0.925490f, 0.904627f, 0.559765f},
+    {0.917647f, 0.894588f, 0.555529f},
+    {0.909804f, 0.884549f, 0.551294f},
+    {0.901961f, 0.874510f, 0.547059f},
+    {0.894118f, 0.864471f, 0.542824f},
+    {0.886275f, 0.854431f, 0.538588f},
+    {0.878431f, 0.844392f, 0.534353f},
+    {0.870588f, 0.834353f, 0.530118f},
+    {0.862745f, 0.824314f, 0.525882f},
+    {0.854902f, 0.814275f, 0.521647f},
+    {0.847059f, 0.804235f, 0.517412f},
+    {0.839216f, 0.794196f, 0.513176f},
+    {0.831373f, 0.784157f, 0.508941f},
+    {0.823529f, 0.774118f, 0.504706f},
+    {0.815686f, 0.764078f, 0.500471f},
+    {0.807843f, 0.754039f, 0.496235f},
+    {0.800000f, 0.744000f, 0.492000f},
+    {0.792157f, 0.733961f, 0.487765f},
+    {0.784314f, 0.723922f, 0.483529f},
+    {0.776471f, 0.713882f, 0.479294f},
+    {0.768627f, 0.703843f, 0.475059f},
+    {0.760784f, 0.693804f, 0.470824f},
+    {0.752941f, 0.683765f, 0.466588f},
+    {0.745098f, 0.673725f, 0.462353f},
+    {0.737255f, 0.663686f, 0.458118f},
+    {0.729412f, 0.653647f, 0.453882f},
+    {0.721569f, 0.643608f, 0.449647f},
+    {0.713725f, 0.633569f, 0.445412f},
+    {0.705882f, 0.623529f, 0.441176f},
+    {0.698039f, 0.613490f, 0.436941f},
+    {0.690196f, 0.603451f, 0.432706f},
+    {0.682353f, 0.593412f, 0.428471f},
+    {0.674510f, 0.583373f, 0.424235f},
+    {0.666667f, 0.573333f, 0.420000f},
+    {0.658824f, 0.563294f, 0.415765f},
+    {0.650980f, 0.553255f, 0.411529f},
+    {0.643137f, 0.543216f, 0.407294f},
+    {0.635294f, 0.533176f, 0.403059f},
+    {0.627451f, 0.523137f, 0.398824f},
+    {0.619608f, 0.513098f, 0.394588f},
+    {0.611765f, 0.503059f, 0.390353f},
+    {0.603922f, 0.493020f, 0.386118f},
+    {0.596078f, 0.482980f, 0.381882f},
+    {0.588235f, 0.472941f, 0.377647f},
+    {0.580392f, 0.462902f, 0.373412f},
+    {0.572549f, 0.452863f, 0.369176f},
+    {0.564706f, 0.442824f, 0.364941f},
+    {0.556863f, 0.432784f, 0.360706f},
+    {0.549020f, 0.422745f, 0.356471f},
+    {0.541176f, 0.412706f, 0.352235f},
+    {0.533333f, 0.402667f, 0.348000f},
+    {0.525490f, 0.392627f, 0.343765f},
+    {0.517647f, 0.382588f, 0.339529f},
+    {0.509804f, 0.372549f, 0.335294f},
+    {0.501961f, 0.362510f, 0.331059f},
+    {0.505882f, 0.367529f, 0.337882f},
+    {0.513725f, 0.377569f, 0.348392f},
+    {0.521569f, 0.387608f, 0.358902f},
+    {0.529412f, 0.397647f, 0.369412f},
+    {0.537255f, 0.407686f, 0.379922f},
+    {0.545098f, 0.417725f, 0.390431f},
+    {0.552941f, 0.427765f, 0.400941f},
+    {0.560784f, 0.437804f, 0.411451f},
+    {0.568627f, 0.447843f, 0.421961f},
+    {0.576471f, 0.457882f, 0.432471f},
+    {0.584314f, 0.467922f, 0.442980f},
+    {0.592157f, 0.477961f, 0.453490f},
+    {0.600000f, 0.488000f, 0.464000f},
+    {0.607843f, 0.498039f, 0.474510f},
+    {0.615686f, 0.508078f, 0.485020f},
+    {0.623529f, 0.518118f, 0.495529f},
+    {0.631373f, 0.528157f, 0.506039f},
+    {0.639216f, 0.538196f, 0.516549f},
+    {0.647059f, 0.548235f, 0.527059f},
+    {0.654902f, 0.558275f, 0.537569f},
+    {0.662745f, 0.568314f, 0.548078f},
+    {0.670588f, 0.578353f, 0.558588f},
+    {0.678431f, 0.588392f, 0.569098f},
+    {0.686275f, 0.598431f, 0.579608f},
+    {0.694118f, 0.608471f, 0.590118f},
+    {0.701961f, 0.618510f, 0.600627f},
+    {0.709804f, 0.628549f, 0.611137f},
+    {0.717647f, 0.638588f, 0.621647f},
+    {0.725490f, 0.648627f, 0.632157f},
+    {0.733333f, 0.658667f, 0.642667f},
+    {0.741176f, 0.668706f, 0.653176f},
+    {0.749020f, 0.678745f, 0.663686f},
+    {0.756863f, 0.688784f, 0.674196f},
+    {0.764706f, 0.698824f, 0.684706f},
+    {0.772549f, 0.708863f, 0.695216f},
+    {0.780392f, 0.718902f, 0.705725f},
+    {0.788235f, 0.728941f, 0.716235f},
+    {0.796078f, 0.738980f, 0.726745f},
+    {0.803922f, 0.749020f, 0.737255f},
+    {0.811765f, 0.759059f, 0.747765f},
+    {0.819608f, 0.769098f, 0.758275f},
+    {0.827451f, 0.779137f, 0.768784f},
+    {0.835294f, 0.789176f, 0.779294f},
+    {0.843137f, 0.799216f, 0.789804f},
+    {0.850980f, 0.809255f, 0.800314f},
+    {0.858824f, 0.819294f, 0.810824f},
+    {0.866667f, 0.829333f, 0.821333f},
+    {0.874510f, 0.839373f, 0.831843f},
+    {0.882353f, 0.849412f, 0.842353f},
+    {0.890196f, 0.859451f, 0.852863f},
+    {0.898039f, 0.869490f, 0.863373f},
+    {0.905882f, 0.879529f, 0.873882f},
+    {0.913725f, 0.889569f, 0.884392f},
+    {0.921569f, 0.899608f, 0.894902f},
+    {0.929412f, 0.909647f, 0.905412f},
+    {0.937255f, 0.919686f, 0.915922f},
+    {0.945098f, 0.929725f, 0.926431f},
+    {0.952941f, 0.939765f, 0.936941f},
+    {0.960784f, 0.949804f, 0.947451f},
+    {0.968627f, 0.959843f, 0.957961f},
+    {0.976471f, 0.969882f, 0.968471f},
+    {0.984314f, 0.979922f, 0.978980f},
+    {0.992157f, 0.989961f, 0.989490f},
+    {1.000000f, 1.000000f, 1.000000f},
+};
+
+const std::vector<Colormaps::Color>& Colormaps::getStops(const std::string& name)
+{
+    static const std::map<std::string, const std::vector<Color>*> colormaps = {{"Blue-to-Red", &BLUE_TO_RED},
+                                                                               {"Grayscale", &GRAYSCALE},
+                                                                               {"Jet", &JET},
+                                                                               {"Turbo", &TURBO},
+                                                                               {"Viridis", &VIRIDIS},
+                                                                               {"Plasma", &PLASMA},
+                                                                               {"Inferno", &INFERNO},
+                                                                               {"Magma", &MAGMA},
+                                                                               {"Gist Earth", &GIST_EARTH},
+                                                                               {"Terrain", &TERRAIN}};
+
+    const auto it = colormaps.find(name);
+    if (it == colormaps.end())
+    {
+        throw std::runtime_error("Unknown colormap: " + name);
+    }
+
+    return *it->second;
+}
+
+Colormaps::Color Colormaps::sample(const std::vector<Color>& stops, float v)
+{
+    if (stops.size() < 2)
+    {
+        return stops.empty() ? Color{0.0f, 0.0f, 0.0f} : stops.front();
+    }
+
+    // Find the segment v falls into and lerp between its two stops
+    const int   segments    = static_cast<int>(stops.size()) - 1;
+    const float scaledValue = std::clamp(v, 0.0f, 1.0f) * static_cast<float>(segments);
+    const int   index0      = std::clamp(static_cast<int>(std::floor(scaledValue)), 0, segments - 1);
+    const float t           = scaledValue - static_cast<float>(index0);
+
+    const Color& color0 = stops[index0];
+    const Color& color1 = stops[index0 + 1];
+
+    return {color0[0] + (color1[0] - color0[0]) * t,
+            color0[1] + (color1[1] - color0[1]) * t,
+            color0[2] + (color1[2] - color0[2]) * t};
+}
@@ -0,0 +1,21 @@
+#ifndef COLORMAPS_HPP
+#define COLORMAPS_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+
+// Colormap definitions, one list of evenly spaced RGB stops per entry of Heatmap::COLORMAP_NAMES.
+// The heatmap bakes them into a lookup texture, so adding a colormap does not touch the shader
+namespace Colormaps
+{
+using Color = std::array<float, 3>;
+
+// Throws if there is no colormap with that name
+const std::vector<Color>& getStops(const std::string& name);
+
+// Piecewise linear interpolation between the stops, v is clamped to [0, 1]
+Color sample(const std::vector<Color>& stops, float v);
+} // namespace Colormaps
+
+#endif
@@ -1,36 +1,241 @@
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
 
 #include "geoData.hpp"
 #include "geoUtils.hpp"
+#include "polygonTriangulator.hpp"
+
+static float distanceToSegment(sf::Vector2f point, sf::Vector2f a, sf::Vector2f b)
+{
+    const sf::Vector2f ab           = b - a;
+    const sf::Vector2f ap           = point - a;
+    const float        lengthSquare = ab.x * ab.x + ab.y * ab.y;
+
+    float t = 0.0f;
+    if (lengthSquare > 0.0f)
+    {
+        t = std::clamp((ap.x * ab.x + ap.y * ab.y) / lengthSquare, 0.0f, 1.0f);
+    }
+
+    const sf::Vector2f delta = ap - ab * t;
+
+    return std::sqrt(delta.x * delta.x + delta.y * delta.y);
+}
+
+// Douglas-Peucker importance of every vertex of a path: the path simplified with tolerance t keeps exactly the
+// vertices whose importance is greater than t. Endpoints are always kept. A split vertex never gets more importance
+// than the one it was found under, so every tolerance yields the same vertices a plain Douglas-Peucker run would
+static void computeSimplificationImportance(const sf::Vector2f*                               points,
+                                            std::size_t                                       count,
+                                            float*                                            outImportance,
+                                            std::vector<std::pair<std::size_t, std::size_t>>& stack)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    std::fill(outImportance, outImportance + count, 0.0f);
+    outImportance[0]         = infinity;
+    outImportance[count - 1] = infinity;
+
+    stack.clear();
+    stack.emplace_back(0, count - 1);
+
+    while (!stack.empty())
+    {
+        const auto [first, last] = stack.back();
+        stack.pop_back();
+
+        if (last - first < 2)
+        {
+            continue;
+        }
+
+        std::size_t farthest    = first + 1;
+        float       maxDistance = -1.0f;
+
+        for (std::size_t i = first + 1; i < last; ++i)
+        {
+            const float distance = distanceToSegment(points[i], points[first], points[last]);
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                farthest    = i;
+            }
+        }
+
+        const float parentImportance = std::min(outImportance[first], outImportance[last]);
+        outImportance[farthest]      = std::min(maxDistance, parentImportance);
+
+        stack.emplace_back(first, farthest);
+        stack.emplace_back(farthest, last);
+    }
+}
 
 GeoData::GeoData()
 {
     scanDataDirectory();
+
+    const std::string shaderFolderPath = SHADERS_PATH;
+    const std::string lineShaderPath   = shaderFolderPath + "/geoLines.frag";
+
+    if (!m_lineShader.loadFromFile(lineShaderPath, sf::Shader::Type::Fragment))
+    {
+        throw std::runtime_error("Failed to load geo lines shader.");
+    }
+}
+
+GeoData::~GeoData()
+{
+    discardPendingLoad();
 }
 
 void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
 {
-    if (!m_geoData || !heatmap.getAscData())
+    if (!m_geoData || !heatmap.getAscData() || !m_hasLocalCoordinates)
+    {
+        return;
+    }
+
+    const sf::Sprite& heatmapSprite = heatmap.getHeatmapSprite();
+    const sf::View&   view          = window.getView();
+
+    const float pixelsPerCell = static_cast<float>(window.getViewport(view).size.x) / view.getSize().x *
+                                heatmapSprite.getScale().x;
+    const float tolerance     = getSimplificationTolerance(pixelsPerCell);
+
+    // The overlay lives in local space, only marker sizes and thickness depend on the sprite scale.
+    // Zooming only rebuilds it when the simplification level changes, which is once per doubling
+    if (m_isOverlayDirty || heatmapSprite.getScale().x != m_overlayScale || tolerance != m_overlayTolerance)
+    {
+        rebuildOverlay(heatmapSprite.getScale().x, tolerance);
+    }
+
+    const GeoUtils::VisibleArea visibleArea = GeoUtils::getVisibleAreaInLocalCoords(window.getView(), heatmapSprite);
+
+    if (m_overlayVertices.empty() || !visibleArea.isValid)
     {
         return;
     }
 
-    const sf::Sprite&           heatmapSprite = heatmap.getHeatmapSprite();
-    const GeoUtils::VisibleArea visibleArea   = GeoUtils::getVisibleAreaInLocalCoords(window.getView(), heatmapSprite);
+    sf::RenderStates states(heatmapSprite.getTransform());
+    states.shader = &m_lineShader;
 
-    if (!visibleArea.isValid)
+    auto drawRun = [&](std::size_t first, std::size_t count)
     {
+        if (sf::VertexBuffer::isAvailable())
+        {
+            window.draw(m_overlayBuffer, first, count, states);
+        }
+        else
+        {
+            window.draw(m_overlayVertices.data() + first, count, sf::PrimitiveType::Triangles, states);
+        }
+    };
+
+    // Grown by the largest marker or line half width, so shapes whose anchor is just outside still show
+    const BBox viewBox(BPoint(visibleArea.left - m_overlayPadding, visibleArea.top - m_overlayPadding),
+                       BPoint(visibleArea.right + m_overlayPadding, visibleArea.bottom + m_overlayPadding));
+
+    if (boost::geometry::covered_by(m_entityBoxes.bounds(), viewBox))
+    {
+        drawRun(0, m_overlayVertices.size());
         return;
     }
 
-    const float left   = visibleArea.left;
-    const float right  = visibleArea.right;
-    const float top    = visibleArea.top;
-    const float bottom = visibleArea.bottom;
+    m_visibleBoxes.clear();
+    m_entityBoxes.query(boost::geometry::index::intersects(viewBox), std::back_inserter(m_visibleBoxes));
 
-    const auto& ascHeader = heatmap.getAscData()->getHeader();
+    m_visibleRuns.clear();
+    for (const EntityBoxValue& value : m_visibleBoxes)
+    {
+        for (const VertexRange& range : {m_overlayFillRanges[value.second], m_overlayRanges[value.second]})
+        {
+            if (range.count > 0)
+            {
+                m_visibleRuns.push_back(range);
+            }
+        }
+    }
+
+    std::sort(m_visibleRuns.begin(),
+              m_visibleRuns.end(),
+              [](const VertexRange& a, const VertexRange& b) { return a.first < b.first; });
+
+    // Entities were laid out in spatial order, so the visible ones mostly sit next to each other in the buffer.
+    // Runs separated by a small gap are drawn as one, a few hidden triangles cost less than another draw call
+    std::size_t runFirst = 0;
+    std::size_t runEnd   = 0;
+
+    for (const VertexRange& range : m_visibleRuns)
+    {
+        if (runEnd > runFirst && range.first > runEnd + OVERLAY_RUN_MERGE_GAP)
+        {
+            drawRun(runFirst, runEnd - runFirst);
+            runFirst = runEnd;
+        }
+
+        if (runEnd == runFirst)
+        {
+            runFirst = range.first;
+        }
+
+        runEnd = std::max(runEnd, range.first + range.count);
+    }
+
+    if (runEnd > runFirst)
+    {
+        drawRun(runFirst, runEnd - runFirst);
+    }
+}
+
+void GeoData::rebuildOverlay(float spriteScale, float tolerance)
+{
+    m_isOverlayDirty   = false;
+    m_overlayScale     = spriteScale;
+    m_overlayTolerance = tolerance;
+    m_overlayVertices.clear();
+    m_overlayRanges.assign(m_geoData->getEntities().size(), VertexRange{});
+    m_overlayFillRanges.assign(m_geoData->getEntities().size(), VertexRange{});
+
+    if (spriteScale <= 0.0f)
+    {
+        return;
+    }
+
+    // Sizes are set in pixels at the default zoom, so they are divided by the sprite scale to get local units
+    const float pixelToLocal = 1.0f / spriteScale;
+    const auto& geometries   = m_geoData->getGeometryStore();
+
+    const float largestPointSize = std::max({m_pointSizeBase, m_pointSizeMin, m_pointSizeMax});
+    m_overlayPadding = (largestPointSize + std::max(2.0f, m_lineThicknessBase)) * pixelToLocal;
+
+    // Each layer is laid out in the order of the bounding box tree, so culling finds the visible vertices in a few runs
+    std::vector<const GeoCsvParser::Entity*> ordered;
+
+    auto inSpatialOrder = [&](EntitySpan group) -> const std::vector<const GeoCsvParser::Entity*>&
+    {
+        ordered.assign(group.begin(), group.end());
+        std::sort(ordered.begin(),
+                  ordered.end(),
+                  [&](const GeoCsvParser::Entity* a, const GeoCsvParser::Entity* b)
+                  { return m_spatialRanks[getEntityIndex(*a)] < m_spatialRanks[getEntityIndex(*b)]; });
+
+        return ordered;
+    };
+
+    auto recordRange = [&](const GeoCsvParser::Entity& entity, std::size_t first)
+    { m_overlayRanges[getEntityIndex(entity)] = VertexRange{first, m_overlayVertices.size() - first}; };
 
     auto getLifeScaledPointSize = [&](double life) -> float
     {
@@ -57,26 +262,53 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         return sf::Color(scale(base.r), scale(base.g), scale(base.b), base.a);
     };
 
-    // This actually is used for both triangles and crosses (crosses are made by two quads which each is made of two triangles).
-    // The point of having a single vertex array is to have a single draw call
-    // Note: circle segments are the only intensive part since they generate many triangles. If noticing any performance issus then consider batching them in a smarter way
-    std::vector<sf::Vertex> triangles;
-    const int triangleVertices = (maximumInRange().size() + minimumInRange().size()) * 3; // three vertices per triangle
-    const int saddleVertices = saddlesInRange().size() * 6 * 2; // two quad per cross. Each quad is two triangles of three vertices
+    // This actually is used for triangles, crosses (crosses are made by two quads which each is made of two triangles),
+    // line segments and area fills. The point of having a single vertex array is to have a single draw call.
+    // The array keeps its capacity between rebuilds
+    std::vector<sf::Vertex>& triangles = m_overlayVertices;
+    const std::size_t triangleVertices = (maximumInRange().size() + minimumInRange().size()) * 3; // three vertices per triangle
+    const std::size_t saddleVertices = saddlesInRange().size() * 6 * 2; // two quad per cross. Each quad is two triangles of three vertices
+
+    // Lines use one quad per segment (see appendSegment) plus one for the end cap of open paths, so a path never emits
+    // more quads than it has vertices. Simplification only removes vertices, the full count is an upper bound
+    std::size_t segmentCount = 0;
+    std::size_t fillVertices = 0;
+
+    auto countSegments = [&](EntitySpan group)
+    {
+        for (const auto* entity : group)
+        {
+            segmentCount += getEntityLocalPoints(*entity).size();
+        }
+    };
+
+    if (m_displayMode == DisplayMode::Lines)
+    {
+        if (getShowLinesAscending())
+        {
+            countSegments(linesAscendingInRange());
+        }
 
-    const int lineAscVertices = getShowLinesAscending() && getDisplayMode() == DisplayMode::Lines
-                                    ? (linesAscendingInRange().size() * 6 * 8 * 3) // quad * circle segments * 3 vertices of each segment
-                                    : 0;
+        if (getShowLinesDescending())
+        {
+            countSegments(linesDescendingInRange());
+        }
+    }
 
-    const int lineDescVertices = getShowLinesDescending() && getDisplayMode() == DisplayMode::Lines
-                                     ? (linesDescendingInRange().size() * 6 * 8 * 3) // quad * circle segments * 3 vertices of each segment
-                                     : 0;
+    if (m_displayMode == DisplayMode::Areas && getShowAreas())
+    {
+        countSegments(areasInRange());
 
-    const int areaVertices = getShowAreas() && getDisplayMode() == DisplayMode::Areas
-                                 ? (areasInRange().size() * (6 * 8 * 3)) // quad * circle segments * 3 vertices of each segment
-                                 : 0;
+        if (getShowAreaFill())
+        {
+            for (const auto* entity : areasInRange())
+            {
+                fillVertices += m_fillRanges[getEntityIndex(*entity)].count;
+            }
+        }
+    }
 
-    triangles.reserve(triangleVertices + saddleVertices + lineAscVertices + lineDescVertices + areaVertices);
+    triangles.reserve(triangleVertices + saddleVertices + 6 * segmentCount + fillVertices);
 
     auto triangleUp = [&](sf::Vector2f center, float radius, sf::Color color)
     {
@@ -115,7 +347,7 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         sf::Vector2f direction = end - start;
         float        length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
 
-        if (length <= 0.0001f)
+        if (length <= 0.0001f * pixelToLocal)
         {
             return;
         }
@@ -140,29 +372,76 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         triangles.push_back(sf::Vertex{v3, color});
     };
 
-    auto appendCircle = [&](sf::Vector2f center, float radius, sf::Color color)
+    // Line quads carry their position in the segment frame as texture coordinates, in radius units: x along the
+    // segment and y across it. shaders/geoLines.frag rounds off the part with negative x and antialiases the edges.
+    // Markers leave them at zero and stay solid
+    auto appendLineQuad = [&](sf::Vector2f a, sf::Vector2f b, sf::Vector2f normal, sf::Vector2f texA, sf::Vector2f texB,
+                              float texY, sf::Color color)
+    {
+        const sf::Vertex v0{a - normal, color, {texA.x, -texY}};
+        const sf::Vertex v1{a + normal, color, {texA.x, texY}};
+        const sf::Vertex v2{b + normal, color, {texB.x, texY}};
+        const sf::Vertex v3{b - normal, color, {texB.x, -texY}};
+
+        triangles.push_back(v0);
+        triangles.push_back(v1);
+        triangles.push_back(v2);
+
+        triangles.push_back(v0);
+        triangles.push_back(v2);
+        triangles.push_back(v3);
+    };
+
+    // Extra width around the line so the antialiased edge is not cut by the quad
+    const float edgeMargin = pixelToLocal;
+
+    // One quad from a radius before start up to end, so the start gets a round cap or join and end is left to the
+    // next segment. Degenerate segments are skipped, the next one starting at the same position caps it
+    auto appendSegment = [&](sf::Vector2f start, sf::Vector2f end, float radius, sf::Color color)
     {
-        if (radius <= 0.0f)
+        sf::Vector2f direction = end - start;
+        const float  length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+
+        if (length <= 0.0001f * pixelToLocal || radius <= 0.0f)
         {
             return;
         }
 
-        const int   segments = 8;
-        const float pi       = 3.14159265359f;
-        const float step     = 2.0f * pi / segments;
+        direction.x /= length;
+        direction.y /= length;
+
+        const float        extent = radius + edgeMargin;
+        const sf::Vector2f normal(-direction.y * extent, direction.x * extent);
+        const float        texExtent = extent / radius;
+
+        appendLineQuad(
+            start - direction * extent, end, normal, {-texExtent, 0.0f}, {length / radius, 0.0f}, texExtent, color);
+    };
 
-        sf::Vector2f prev(center.x + radius, center.y);
+    // The half cap past the last point of an open path, its segment already covers the other half
+    auto appendEndCap = [&](LocalSpan path, float radius, sf::Color color)
+    {
+        const sf::Vector2f end = path[path.size() - 1];
 
-        for (int i = 1; i <= segments; ++i)
+        for (std::size_t i = path.size() - 1; i-- > 0;)
         {
-            const float        angle = i * step;
-            const sf::Vector2f current(center.x + std::cos(angle) * radius, center.y + std::sin(angle) * radius);
+            sf::Vector2f direction = end - path[i];
+            const float  length    = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+
+            if (length <= 0.0001f * pixelToLocal)
+            {
+                continue;
+            }
 
-            triangles.push_back(sf::Vertex{center, color});
-            triangles.push_back(sf::Vertex{prev, color});
-            triangles.push_back(sf::Vertex{current, color});
+            direction.x /= length;
+            direction.y /= length;
 
-            prev = current;
+            const float        extent = radius + edgeMargin;
+            const sf::Vector2f normal(-direction.y * extent, direction.x * extent);
+            const float        texExtent = extent / radius;
+
+            appendLineQuad(end, end + direction * extent, normal, {0.0f, 0.0f}, {-texExtent, 0.0f}, texExtent, color);
+            return;
         }
     };
 
@@ -177,106 +456,111 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         const sf::Vector2f topRightCorner(center.x + armHalfLen, center.y - armHalfLen);
 
         // Thickness must be proportional to the radius
-        const float crossThickness = std::max(2.0f, radius * 0.20f);
+        const float crossThickness = std::max(2.0f * pixelToLocal, radius * 0.20f);
 
         appendRectangle(topLeftCorner, bottomRightCorner, crossThickness, color);
         appendRectangle(bottomLeftCorner, topRightCorner, crossThickness, color);
     };
 
-    auto isPointWithinVisibleArea = [&](const sf::Vector2f& point) -> bool
-    { return !(point.x < left || point.x > right || point.y < top || point.y > bottom); };
-
-
-    auto emit = [&](const std::vector<const GeoCsvParser::Entity*>& group, sf::Color color, Shape shape)
+    auto emit = [&](EntitySpan group, sf::Color color, Shape shape)
     {
-        for (const auto* entity : group)
+        for (const auto* entity : inSpatialOrder(group))
         {
             if (!entity || entity->geom.type != GeoCsvParser::GeometryType::Point)
             {
                 continue;
             }
 
-            const sf::Vector2f localPoint = GeoUtils::wktToLocal(entity->geom.point, ascHeader);
-
-            // Cull only the ones in visible sprite area
-            if (!isPointWithinVisibleArea(localPoint))
-            {
-                continue;
-            }
-
-            const sf::Vector2f transformedPoint = heatmap.getHeatmapSprite().getTransform().transformPoint(localPoint);
-            const float        sideLength       = getLifeScaledPointSize(entity->life);
+            const sf::Vector2f localPoint = getLocalPosition(*entity);
+            const float        sideLength = getLifeScaledPointSize(entity->life) * pixelToLocal;
+            const std::size_t  first      = triangles.size();
 
             switch (shape)
             {
                 case Shape::TriangleUp:
-                    triangleUp(transformedPoint, sideLength, color);
+                    triangleUp(localPoint, sideLength, color);
                     break;
                 case Shape::TriangleDown:
-                    triangleDown(transformedPoint, sideLength, color);
+                    triangleDown(localPoint, sideLength, color);
                     break;
                 case Shape::Cross:
-                    cross(transformedPoint, sideLength, color);
+                    cross(localPoint, sideLength, color);
                     break;
             }
+
+            recordRange(*entity, first);
         }
     };
 
-    if (m_displayMode == DisplayMode::Lines)
+    const float lineRadius = std::max(1.0f, m_lineThicknessBase) * 0.5f * pixelToLocal;
+
+    // Vertices closer than the tolerance to the simplified path would land within half a pixel of it
+    std::vector<sf::Vector2f> simplified;
+
+    auto simplify = [&](LocalSpan path) -> LocalSpan
     {
-        const float thickness = std::max(1.0f, m_lineThicknessBase);
+        const float* importance = m_localImportance.data() + (path.first - m_localPoints.data());
 
-        auto emitLineString = [&](const std::vector<GeoCsvParser::Point>& path, sf::Color color, double life)
+        simplified.clear();
+        for (std::size_t i = 0; i < path.size(); ++i)
         {
-            if (path.size() < 2)
+            if (importance[i] > tolerance)
             {
-                return;
+                simplified.push_back(path[i]);
             }
+        }
 
-            const sf::Color lineColor   = applyBrightness(color, life);
-            const float     jointRadius = thickness * 0.5f;
+        return LocalSpan{simplified.data(), simplified.size()};
+    };
 
-            // Draw segments as rectangles
-            for (std::size_t i = 0; i + 1 < path.size(); ++i)
-            {
-                const sf::Vector2f aLocal = GeoUtils::wktToLocal(path[i], ascHeader);
-                const sf::Vector2f bLocal = GeoUtils::wktToLocal(path[i + 1], ascHeader);
+    auto emitLineString = [&](LocalSpan fullPath, sf::Color color, double life)
+    {
+        const LocalSpan path = simplify(fullPath);
 
-                // Draw if at least one endpoint is visible in the current view
-                if (!isPointWithinVisibleArea(aLocal) && !isPointWithinVisibleArea(bLocal))
-                {
-                    continue;
-                }
+        if (path.size() < 2)
+        {
+            return;
+        }
 
-                const sf::Vector2f aWorld = heatmapSprite.getTransform().transformPoint(aLocal);
-                const sf::Vector2f bWorld = heatmapSprite.getTransform().transformPoint(bLocal);
+        const sf::Color lineColor = applyBrightness(color, life);
 
-                appendRectangle(aWorld, bWorld, thickness, lineColor);
-            }
+        for (std::size_t i = 0; i + 1 < path.size(); ++i)
+        {
+            appendSegment(path[i], path[i + 1], lineRadius, lineColor);
+        }
 
-            // Draw joint circles at endpoints
-            for (const auto& endpoint : path)
-            {
-                const sf::Vector2f localPosition = GeoUtils::wktToLocal(endpoint, ascHeader);
+        appendEndCap(path, lineRadius, lineColor);
+    };
 
-                if (!isPointWithinVisibleArea(localPosition))
-                {
-                    continue;
-                }
+    auto emitClosedRing = [&](LocalSpan fullRing, sf::Color color, double life)
+    {
+        const LocalSpan ring = simplify(fullRing);
 
-                const sf::Vector2f worldPosition = heatmapSprite.getTransform().transformPoint(localPosition);
-                appendCircle(worldPosition, jointRadius, lineColor);
-            }
-        };
+        if (ring.size() < 2)
+        {
+            return;
+        }
+
+        const sf::Color ringColor = applyBrightness(color, life);
 
+        // The closing segment caps the last vertex, so rings need no end cap
+        const std::size_t N = ring.size();
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            appendSegment(ring[i], ring[(i + 1) % N], lineRadius, ringColor);
+        }
+    };
+
+    if (m_displayMode == DisplayMode::Lines)
+    {
         // For each linestring in the geometry emit a line. Note: lines.size() is 1 for LINESTRING and >=1 for MULTILINESTRING but they are basically the same behavior
         auto emitLines = [&](const GeoCsvParser::Geometry& geometry, sf::Color color, double life)
         {
-            for (const auto& lineString : geometry.lines)
+            for (const auto& lineString : geometries.getLines(geometry))
             {
                 if (lineString.points.size() >= 2)
                 {
-                    emitLineString(lineString.points, color, life);
+                    emitLineString(getLocalSpan(lineString.points), color, life);
                 }
             }
         };
@@ -284,128 +568,73 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         if (getShowLinesAscending())
         {
             const sf::Color color = getLineAscColor();
-            for (const auto* entity : linesAscendingInRange())
+            for (const auto* entity : inSpatialOrder(linesAscendingInRange()))
             {
+                const std::size_t first = triangles.size();
                 emitLines(entity->geom, color, entity->life);
+                recordRange(*entity, first);
             }
         }
 
         if (getShowLinesDescending())
         {
             const sf::Color color = getLineDescColor();
-            for (const auto* entity : linesDescendingInRange())
+            for (const auto* entity : inSpatialOrder(linesDescendingInRange()))
             {
+                const std::size_t first = triangles.size();
                 emitLines(entity->geom, color, entity->life);
+                recordRange(*entity, first);
             }
         }
     }
 
     if (m_displayMode == DisplayMode::Areas && getShowAreas())
     {
-        const float     thickness  = std::max(1.0f, m_lineThicknessBase);
         const sf::Color areasColor = getAreasColor();
 
-        auto emitLineString = [&](const std::vector<GeoCsvParser::Point>& path, sf::Color color, double life)
+        // Fills go first so every stroke stays on top of them
+        if (getShowAreaFill())
         {
-            if (path.size() < 2)
-            {
-                return;
-            }
-
-            const sf::Color lineColor   = applyBrightness(color, life);
-            const float     jointRadius = thickness * 0.5f;
-
-            // Draw segments as rectangles
-            for (std::size_t i = 0; i + 1 < path.size(); ++i)
+            for (const auto* entity : inSpatialOrder(areasInRange()))
             {
-                const sf::Vector2f aLocal = GeoUtils::wktToLocal(path[i], ascHeader);
-                const sf::Vector2f bLocal = GeoUtils::wktToLocal(path[i + 1], ascHeader);
+                const std::size_t  entityIndex = getEntityIndex(*entity);
+                const VertexRange& fill        = m_fillRanges[entityIndex];
 
-                // Draw if at least one endpoint is visible in the current view
-                if (!isPointWithinVisibleArea(aLocal) && !isPointWithinVisibleArea(bLocal))
+                if (fill.count == 0)
                 {
                     continue;
                 }
 
-                const sf::Vector2f aWorld = heatmapSprite.getTransform().transformPoint(aLocal);
-                const sf::Vector2f bWorld = heatmapSprite.getTransform().transformPoint(bLocal);
-
-                appendRectangle(aWorld, bWorld, thickness, lineColor);
-            }
-
-            // Draw joint circles at endpoints
-            for (const auto& endpoint : path)
-            {
-                const sf::Vector2f localPosition = GeoUtils::wktToLocal(endpoint, ascHeader);
+                sf::Color fillColor = applyBrightness(areasColor, entity->life);
+                fillColor.a         = static_cast<std::uint8_t>(std::roundf(fillColor.a * AREA_FILL_OPACITY));
 
-                if (!isPointWithinVisibleArea(localPosition))
+                const std::size_t first = triangles.size();
+                for (std::size_t i = fill.first; i < fill.first + fill.count; ++i)
                 {
-                    continue;
+                    triangles.push_back(sf::Vertex{m_localPoints[m_fillIndices[i]], fillColor});
                 }
 
-                const sf::Vector2f worldPosition = heatmapSprite.getTransform().transformPoint(localPosition);
-                appendCircle(worldPosition, jointRadius, lineColor);
-            }
-        };
-
-        auto emitClosedRing = [&](const std::vector<GeoCsvParser::Point>& ring, sf::Color color, double life)
-        {
-            if (ring.size() < 2)
-            {
-                return;
+                m_overlayFillRanges[entityIndex] = VertexRange{first, triangles.size() - first};
             }
-
-            const sf::Color ringColor   = applyBrightness(color, life);
-            const float     jointRadius = thickness * 0.5f;
-
-            const std::size_t N = ring.size();
-            for (std::size_t i = 0; i < N; ++i)
-            {
-                const std::size_t j = (i + 1) % N;
-
-                const sf::Vector2f aLocal = GeoUtils::wktToLocal(ring[i], ascHeader);
-                const sf::Vector2f bLocal = GeoUtils::wktToLocal(ring[j], ascHeader);
-
-                if (!isPointWithinVisibleArea(aLocal) && !isPointWithinVisibleArea(bLocal))
-                {
-                    continue;
-                }
-
-                const sf::Vector2f aWorld = heatmap.getHeatmapSprite().getTransform().transformPoint(aLocal);
-                const sf::Vector2f bWorld = heatmap.getHeatmapSprite().getTransform().transformPoint(bLocal);
-
-                appendRectangle(aWorld, bWorld, thickness, ringColor);
-            }
-
-            for (const auto& point : ring)
-            {
-                const sf::Vector2f localPosition = GeoUtils::wktToLocal(point, ascHeader);
-                if (!isPointWithinVisibleArea(localPosition))
-                {
-                    continue;
-                }
-
-                const sf::Vector2f pWorld = heatmap.getHeatmapSprite().getTransform().transformPoint(localPosition);
-                appendCircle(pWorld, jointRadius, ringColor);
-            }
-        };
+        }
 
         // Areas can come both as Polygon and MultiLineString
         auto emitAreaGeometry = [&](const GeoCsvParser::Geometry& geom, sf::Color color, double life)
         {
-            bool drewPolygons = false;
+            bool       drewPolygons = false;
+            const auto polygons     = geometries.getPolygons(geom);
 
-            if (!geom.polygons.empty())
+            if (!polygons.empty())
             {
                 drewPolygons = true;
-                for (const auto& polygon : geom.polygons)
+                for (const auto& polygon : polygons)
                 {
                     // outer line and holes
                     for (const auto& ring : polygon.rings)
                     {
                         if (ring.points.size() >= 2)
                         {
-                            emitClosedRing(ring.points, color, life);
+                            emitClosedRing(getLocalSpan(ring.points), color, life);
                         }
                     }
                 }
@@ -413,19 +642,21 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
 
             if (!drewPolygons)
             {
-                for (const auto& line : geom.lines)
+                for (const auto& line : geometries.getLines(geom))
                 {
                     if (line.points.size() >= 2)
                     {
-                        emitLineString(line.points, color, life);
+                        emitLineString(getLocalSpan(line.points), color, life);
                     }
                 }
             }
         };
 
-        for (const auto* entity : areasInRange())
+        for (const auto* entity : inSpatialOrder(areasInRange()))
         {
+            const std::size_t first = triangles.size();
             emitAreaGeometry(entity->geom, areasColor, entity->life);
+            recordRange(*entity, first);
         }
     }
 
@@ -445,9 +676,21 @@ void GeoData::draw(Heatmap& heatmap, sf::RenderWindow& window)
         emit(saddlesInRange(), getSaddlesColor(), Shape::Cross);
     }
 
-    if (!triangles.empty())
+    if (triangles.empty() || !sf::VertexBuffer::isAvailable())
+    {
+        return;
+    }
+
+    // Uploaded once here, every frame until the next rebuild only issues the draw call
+    if (m_overlayBuffer.getVertexCount() < triangles.size() && !m_overlayBuffer.create(triangles.size()))
     {
-        window.draw(triangles.data(), triangles.size(), sf::PrimitiveType::Triangles);
+        std::cerr << "GeoData - failed to create the overlay vertex buffer" << std::endl;
+        return;
+    }
+
+    if (!m_overlayBuffer.update(triangles.data(), triangles.size(), 0))
+    {
+        std::cerr << "GeoData - failed to upload the overlay vertex buffer" << std::endl;
     }
 }
 
@@ -481,15 +724,49 @@ void GeoData::loadData(int fileIndex)
         return;
     }
 
-    m_selectedFileIndex         = fileIndex;
-    const std::string& filename = m_geoFiles[m_selectedFileIndex];
+    discardPendingLoad();
+
+    const std::string geoFolderPath = GEO_DATA_PATH;
+    const std::string filepath      = geoFolderPath + "/" + m_geoFiles[fileIndex];
+
+    // Rows are independent, so their geometry is parsed on several threads
+    GeoCsvParser::LoadOptions options;
+    options.mode     = GeoCsvParser::LoadMode::Parallel;
+    options.progress = &m_loadProgress;
+
+    m_loadProgress.reset();
+    m_loadingFileIndex = fileIndex;
+    m_pendingLoad      = std::async(std::launch::async,
+                                    [filepath, options]()
+                                    {
+                                        LoadedData loaded;
+                                        loaded.parser = std::make_unique<GeoCsvParser>(filepath, options);
+                                        groupEntities(*loaded.parser, loaded.groups);
+
+                                        return loaded;
+                                    });
+}
+
+bool GeoData::finishLoading()
+{
+    if (!isLoading() || m_pendingLoad.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+
+    const int fileIndex = m_loadingFileIndex;
+    m_loadingFileIndex  = -1;
+
+    const std::string& filename = m_geoFiles[fileIndex];
 
     try
     {
-        const std::string geoFolderPath = GEO_DATA_PATH;
-        const std::string filepath      = geoFolderPath + "/" + filename;
+        LoadedData loaded = m_pendingLoad.get();
 
-        m_geoData = std::make_unique<GeoCsvParser>(filepath);
+        m_geoData           = std::move(loaded.parser);
+        m_groups            = std::move(loaded.groups);
+        m_selectedFileIndex = fileIndex;
+        clearLocalCoordinates();
 
         m_lifeMin = m_geoData->getMinLife();
         m_lifeMax = m_geoData->getMaxLife();
@@ -497,30 +774,77 @@ void GeoData::loadData(int fileIndex)
         m_lifeFilterMin = m_lifeMin;
         m_lifeFilterMax = m_lifeMax;
 
-        groupEntities();
         updateLifeFilteredGroups();
 
         std::cout << "GeoData loaded '" << filename << "' with " << m_geoData->getEntities().size()
                   << " entities. Life: [" << m_lifeMin << ", " << m_lifeMax << "]\n";
+    } catch (const LoadCancelled&)
+    {
+        // Keep whatever was shown before the load started
+        return false;
     } catch (const std::exception& e)
     {
         std::cerr << "Failed to load geo data: " << e.what() << std::endl;
+        m_selectedFileIndex = fileIndex;
         m_geoData.reset();
         m_groups.clear();
         m_groupsInRange.clear();
+        clearLocalCoordinates();
         m_lifeMin = m_lifeMax = 0.0;
         m_lifeFilterMin       = 0.0;
         m_lifeFilterMax       = 0.0;
     }
+
+    return true;
+}
+
+void GeoData::cancelLoading()
+{
+    if (isLoading())
+    {
+        m_loadProgress.cancel();
+    }
+}
+
+// Cancels and joins the worker. The parser polls cancellation often, so this does not block for long
+void GeoData::discardPendingLoad()
+{
+    if (!isLoading())
+    {
+        return;
+    }
+
+    m_loadProgress.cancel();
+    m_pendingLoad.wait();
+    m_pendingLoad      = {};
+    m_loadingFileIndex = -1;
+}
+
+bool GeoData::isLoading() const
+{
+    return m_pendingLoad.valid();
+}
+
+int GeoData::getLoadingFileIndex() const
+{
+    return m_loadingFileIndex;
+}
+
+const LoadProgress& GeoData::getLoadProgress() const
+{
+    return m_loadProgress;
 }
 
 void GeoData::unloadData()
 {
+    discardPendingLoad();
+
     m_geoData.reset();
     m_selectedFileIndex = -1;
 
     m_groups.clear();
     m_groupsInRange.clear();
+    clearLocalCoordinates();
 
     m_lifeMin       = 0.0;
     m_lifeMax       = 0.0;
@@ -528,6 +852,197 @@ void GeoData::unloadData()
     m_lifeFilterMax = 0.0;
 }
 
+void GeoData::updateLocalCoordinates(const Heatmap& heatmap)
+{
+    clearLocalCoordinates();
+
+    if (!m_geoData || !heatmap.getAscData())
+    {
+        return;
+    }
+
+    const auto& header   = heatmap.getAscData()->getHeader();
+    const auto& points   = m_geoData->getGeometryStore().points;
+    const auto& entities = m_geoData->getEntities();
+
+    m_localPoints.reserve(points.size());
+    for (const auto& point : points)
+    {
+        m_localPoints.push_back(GeoUtils::wktToLocal(point, header));
+    }
+
+    // Every line and polygon ring is one ring of the store
+    const auto&                                      store = m_geoData->getGeometryStore();
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+
+    m_localImportance.resize(m_localPoints.size());
+    for (uint32_t ring = 0; ring < store.getRingCount(); ++ring)
+    {
+        const uint32_t first = store.ringStarts[ring];
+        const uint32_t end   = store.ringStarts[ring + 1];
+
+        computeSimplificationImportance(
+            m_localPoints.data() + first, end - first, m_localImportance.data() + first, stack);
+    }
+
+    m_localPositions.resize(entities.size());
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        if (entities[i].geom.type == GeoCsvParser::GeometryType::Point)
+        {
+            m_localPositions[i] = GeoUtils::wktToLocal(entities[i].geom.point, header);
+        }
+    }
+
+    // Bulk loading packs the tree, its leaves then also give the spatial order the overlay is laid out in
+    std::vector<EntityBoxValue> boxes;
+    boxes.reserve(entities.size());
+
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        if (entities[i].geom.type == GeoCsvParser::GeometryType::Point)
+        {
+            const sf::Vector2f& position = m_localPositions[i];
+            boxes.emplace_back(BBox(BPoint(position.x, position.y), BPoint(position.x, position.y)), i);
+            continue;
+        }
+
+        const LocalSpan points = getEntityLocalPoints(entities[i]);
+        if (points.empty())
+        {
+            continue;
+        }
+
+        sf::Vector2f min = points[0];
+        sf::Vector2f max = points[0];
+
+        for (const sf::Vector2f& point : points)
+        {
+            min.x = std::min(min.x, point.x);
+            min.y = std::min(min.y, point.y);
+            max.x = std::max(max.x, point.x);
+            max.y = std::max(max.y, point.y);
+        }
+
+        boxes.emplace_back(BBox(BPoint(min.x, min.y), BPoint(max.x, max.y)), i);
+    }
+
+    m_entityBoxes = EntityRTree(boxes.begin(), boxes.end());
+
+    m_spatialRanks.assign(entities.size(), 0);
+    std::size_t rank = 0;
+
+    for (const EntityBoxValue& value : m_entityBoxes)
+    {
+        m_spatialRanks[value.second] = rank++;
+    }
+
+    // Polygons are triangulated once here, rebuilding the overlay only copies their triangles
+    PolygonTriangulator                    triangulator;
+    std::vector<PolygonTriangulator::Ring> rings;
+
+    m_fillRanges.assign(entities.size(), VertexRange{});
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        if (entities[i].type != GeoCsvParser::EntityType::Area)
+        {
+            continue;
+        }
+
+        const std::size_t first = m_fillIndices.size();
+
+        for (const auto& polygon : store.getPolygons(entities[i].geom))
+        {
+            rings.clear();
+            for (const auto& ring : polygon.rings)
+            {
+                const auto ringFirst = static_cast<uint32_t>(ring.points.first - store.points.data());
+                rings.push_back({ringFirst, static_cast<uint32_t>(ring.points.size())});
+            }
+
+            triangulator.triangulate(m_localPoints.data(), rings, m_fillIndices);
+        }
+
+        m_fillRanges[i] = VertexRange{first, m_fillIndices.size() - first};
+    }
+
+    m_hasLocalCoordinates = true;
+}
+
+bool GeoData::hasLocalCoordinates() const
+{
+    return m_hasLocalCoordinates;
+}
+
+GeoData::LocalSpan GeoData::getLocalSpan(GeoCsvParser::PointSpan span) const
+{
+    const std::size_t first = static_cast<std::size_t>(span.first - m_geoData->getGeometryStore().points.data());
+
+    return LocalSpan{m_localPoints.data() + first, span.count};
+}
+
+sf::Vector2f GeoData::getLocalPosition(const GeoCsvParser::Entity& entity) const
+{
+    return m_localPositions[getEntityIndex(entity)];
+}
+
+float GeoData::getSimplificationTolerance(float pixelsPerCell)
+{
+    if (!(pixelsPerCell > 0.0f))
+    {
+        return 0.0f;
+    }
+
+    // Snapped up to a power of two pixels per cell, so the error stays under SIMPLIFICATION_PIXELS at any zoom
+    const float level = std::ceil(std::log2(pixelsPerCell));
+
+    return SIMPLIFICATION_PIXELS / std::exp2(level);
+}
+
+std::size_t GeoData::getEntityIndex(const GeoCsvParser::Entity& entity) const
+{
+    return static_cast<std::size_t>(&entity - m_geoData->getEntities().data());
+}
+
+GeoData::LocalSpan GeoData::getEntityLocalPoints(const GeoCsvParser::Entity& entity) const
+{
+    const auto& store = m_geoData->getGeometryStore();
+    const auto& geom  = entity.geom;
+
+    if (geom.type == GeoCsvParser::GeometryType::Point || geom.partCount == 0)
+    {
+        return {};
+    }
+
+    // The rings of consecutive parts are consecutive too, so the whole geometry is one run of points
+    const uint32_t first = store.ringStarts[store.partStarts[geom.firstPart]];
+    const uint32_t end   = store.ringStarts[store.partStarts[geom.firstPart + geom.partCount]];
+
+    return LocalSpan{m_localPoints.data() + first, static_cast<std::size_t>(end - first)};
+}
+
+void GeoData::clearLocalCoordinates()
+{
+    m_localPoints.clear();
+    m_localPoints.shrink_to_fit();
+    m_localPositions.clear();
+    m_localPositions.shrink_to_fit();
+    m_localImportance.clear();
+    m_localImportance.shrink_to_fit();
+    m_hasLocalCoordinates = false;
+
+    m_entityBoxes.clear();
+    m_spatialRanks.clear();
+    m_fillIndices.clear();
+    m_fillIndices.shrink_to_fit();
+    m_fillRanges.clear();
+
+    m_overlayVertices.clear();
+    m_overlayRanges.clear();
+    m_overlayFillRanges.clear();
+    m_isOverlayDirty = true;
+}
+
 void GeoData::resetColorsToDefaults()
 {
     setMaximumColor(m_defaults.colorMaximum);
@@ -546,6 +1061,7 @@ void GeoData::resetVisibilityToDefaults()
     setShowLinesAscending(m_defaults.showLinesAscending);
     setShowLinesDescending(m_defaults.showLinesDescending);
     setShowAreas(m_defaults.showAreas);
+    setShowAreaFill(m_defaults.showAreaFill);
 }
 
 void GeoData::resetPointScalingToDefaults()
@@ -571,101 +1087,80 @@ void GeoData::resetLifeFilterToDefaults()
     setLifeFilterRange(m_lifeMin, m_lifeMax);
 }
 
-void GeoData::groupEntities()
+void GeoData::groupEntities(const GeoCsvParser& geoData, Groups& groups)
 {
-    m_groups.clear();
-    if (!m_geoData)
-    {
-        return;
-    }
+    groups.clear();
 
-    const auto& entities = m_geoData->getEntities();
+    const auto& entities = geoData.getEntities();
     for (const auto& entity : entities)
     {
         switch (entity.type)
         {
             case GeoCsvParser::EntityType::Maximum:
-                m_groups.maximum.push_back(&entity);
+                groups.maximum.push_back(&entity);
                 break;
             case GeoCsvParser::EntityType::Minimum:
-                m_groups.minimum.push_back(&entity);
+                groups.minimum.push_back(&entity);
                 break;
             case GeoCsvParser::EntityType::Saddle:
-                m_groups.saddles.push_back(&entity);
+                groups.saddles.push_back(&entity);
                 break;
             case GeoCsvParser::EntityType::LineAscending:
-                m_groups.linesAscending.push_back(&entity);
+                groups.linesAscending.push_back(&entity);
                 break;
             case GeoCsvParser::EntityType::LineDescending:
-                m_groups.linesDescending.push_back(&entity);
+                groups.linesDescending.push_back(&entity);
                 break;
             case GeoCsvParser::EntityType::Area:
-                m_groups.areas.push_back(&entity);
+                groups.areas.push_back(&entity);
                 break;
             default:
                 break;
         }
     }
+
+    // Stable so entities of equal life keep their file order
+    auto byLife = [](const GeoCsvParser::Entity* a, const GeoCsvParser::Entity* b) { return a->life < b->life; };
+
+    std::stable_sort(groups.maximum.begin(), groups.maximum.end(), byLife);
+    std::stable_sort(groups.minimum.begin(), groups.minimum.end(), byLife);
+    std::stable_sort(groups.saddles.begin(), groups.saddles.end(), byLife);
+    std::stable_sort(groups.linesAscending.begin(), groups.linesAscending.end(), byLife);
+    std::stable_sort(groups.linesDescending.begin(), groups.linesDescending.end(), byLife);
+    std::stable_sort(groups.areas.begin(), groups.areas.end(), byLife);
 }
 
 void GeoData::updateLifeFilteredGroups()
 {
     m_groupsInRange.clear();
+    m_isOverlayDirty = true;
+
     if (!m_geoData)
     {
         return;
     }
 
-    auto isInRange = [&](const GeoCsvParser::Entity* e)
-    { return (e->life >= m_lifeFilterMin && e->life <= m_lifeFilterMax); };
-
-    for (auto* entity : m_groups.maximum)
-    {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.maximum.push_back(entity);
-        }
-    }
-
-    for (auto* entity : m_groups.minimum)
-    {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.minimum.push_back(entity);
-        }
-    }
-
-    for (auto* entity : m_groups.saddles)
-    {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.saddles.push_back(entity);
-        }
-    }
-
-    for (auto* entity : m_groups.linesAscending)
-    {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.linesAscending.push_back(entity);
-        }
-    }
-
-    for (auto* entity : m_groups.linesDescending)
+    // Groups are sorted by life, so the in range entities are the run between two binary searches
+    auto getInRange = [&](const std::vector<const GeoCsvParser::Entity*>& group) -> EntitySpan
     {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.linesDescending.push_back(entity);
-        }
-    }
+        const auto lower = std::lower_bound(group.begin(),
+                                            group.end(),
+                                            m_lifeFilterMin,
+                                            [](const GeoCsvParser::Entity* e, double life) { return e->life < life; });
+        const auto upper = std::upper_bound(lower,
+                                            group.end(),
+                                            m_lifeFilterMax,
+                                            [](double life, const GeoCsvParser::Entity* e) { return life < e->life; });
+
+        return EntitySpan{group.data() + (lower - group.begin()), static_cast<std::size_t>(upper - lower)};
+    };
 
-    for (auto* entity : m_groups.areas)
-    {
-        if (isInRange(entity))
-        {
-            m_groupsInRange.areas.push_back(entity);
-        }
-    }
+    m_groupsInRange.maximum         = getInRange(m_groups.maximum);
+    m_groupsInRange.minimum         = getInRange(m_groups.minimum);
+    m_groupsInRange.saddles         = getInRange(m_groups.saddles);
+    m_groupsInRange.linesAscending  = getInRange(m_groups.linesAscending);
+    m_groupsInRange.linesDescending = getInRange(m_groups.linesDescending);
+    m_groupsInRange.areas           = getInRange(m_groups.areas);
 }
 
 void GeoData::setLifeFilterRange(double minValue, double maxValue)
@@ -808,34 +1303,51 @@ bool GeoData::getShowAreas() const
     return m_toggles.areas;
 }
 
+bool GeoData::getShowAreaFill() const
+{
+    return m_toggles.areaFill;
+}
+
 void GeoData::setShowMaximum(bool value)
 {
     m_toggles.maximum = value;
+    m_isOverlayDirty  = true;
 }
 
 void GeoData::setShowMinimum(bool value)
 {
     m_toggles.minimum = value;
+    m_isOverlayDirty  = true;
 }
 
 void GeoData::setShowSaddles(bool value)
 {
     m_toggles.saddles = value;
+    m_isOverlayDirty  = true;
 }
 
 void GeoData::setShowLinesAscending(bool value)
 {
     m_toggles.linesAscending = value;
+    m_isOverlayDirty         = true;
 }
 
 void GeoData::setShowLinesDescending(bool value)
 {
     m_toggles.linesDescending = value;
+    m_isOverlayDirty          = true;
 }
 
 void GeoData::setShowAreas(bool value)
 {
-    m_toggles.areas = value;
+    m_toggles.areas  = value;
+    m_isOverlayDirty = true;
+}
+
+void GeoData::setShowAreaFill(bool value)
+{
+    m_toggles.areaFill = value;
+    m_isOverlayDirty   = true;
 }
 
 double GeoData::getLifeFilterMin() const
@@ -848,32 +1360,32 @@ double GeoData::getLifeFilterMax() const
     return m_lifeFilterMax;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::maximumInRange() const
+GeoData::EntitySpan GeoData::maximumInRange() const
 {
     return m_groupsInRange.maximum;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::minimumInRange() const
+GeoData::EntitySpan GeoData::minimumInRange() const
 {
     return m_groupsInRange.minimum;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::saddlesInRange() const
+GeoData::EntitySpan GeoData::saddlesInRange() const
 {
     return m_groupsInRange.saddles;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::linesAscendingInRange() const
+GeoData::EntitySpan GeoData::linesAscendingInRange() const
 {
     return m_groupsInRange.linesAscending;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::linesDescendingInRange() const
+GeoData::EntitySpan GeoData::linesDescendingInRange() const
 {
     return m_groupsInRange.linesDescending;
 }
 
-const std::vector<const GeoCsvParser::Entity*>& GeoData::areasInRange() const
+GeoData::EntitySpan GeoData::areasInRange() const
 {
     return m_groupsInRange.areas;
 }
@@ -885,7 +1397,8 @@ GeoData::DisplayMode GeoData::getDisplayMode() const
 
 void GeoData::setDisplayMode(DisplayMode value)
 {
-    m_displayMode = value;
+    m_displayMode    = value;
+    m_isOverlayDirty = true;
 }
 
 sf::Color GeoData::getMaximumColor() const
@@ -920,32 +1433,38 @@ sf::Color GeoData::getAreasColor() const
 
 void GeoData::setMaximumColor(sf::Color value)
 {
-    m_colorMaximum = value;
+    m_colorMaximum   = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setMinimumColor(sf::Color value)
 {
-    m_colorMinimum = value;
+    m_colorMinimum   = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setSaddlesColor(sf::Color value)
 {
-    m_colorSaddles = value;
+    m_colorSaddles   = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setLineAscColor(sf::Color value)
 {
-    m_colorLineAsc = value;
+    m_colorLineAsc   = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setLineDescColor(sf::Color value)
 {
-    m_colorLineDesc = value;
+    m_colorLineDesc  = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setAreasColor(sf::Color value)
 {
-    m_colorAreas = value;
+    m_colorAreas     = value;
+    m_isOverlayDirty = true;
 }
 
 bool GeoData::getPointSizeScaleByLife() const
@@ -956,6 +1475,7 @@ bool GeoData::getPointSizeScaleByLife() const
 void GeoData::setPointSizeScaleByLife(bool value)
 {
     m_pointSizeScaleByLife = value;
+    m_isOverlayDirty       = true;
 }
 
 bool GeoData::getLineColorScaleByLife() const
@@ -966,6 +1486,7 @@ bool GeoData::getLineColorScaleByLife() const
 void GeoData::setLineColorScaleByLife(bool value)
 {
     m_lineColorScaleByLife = value;
+    m_isOverlayDirty       = true;
 }
 
 float GeoData::getPointSizeBase() const
@@ -975,13 +1496,15 @@ float GeoData::getPointSizeBase() const
 
 void GeoData::setPointSizeBase(float value)
 {
-    m_pointSizeBase = value;
+    m_pointSizeBase  = value;
+    m_isOverlayDirty = true;
 }
 
 void GeoData::setPointSizeRange(float minValue, float maxValue)
 {
-    m_pointSizeMin = minValue;
-    m_pointSizeMax = maxValue;
+    m_pointSizeMin   = minValue;
+    m_pointSizeMax   = maxValue;
+    m_isOverlayDirty = true;
 }
 
 float GeoData::getPointSizeMin() const
@@ -1002,6 +1525,7 @@ float GeoData::getLineThicknessBase() const
 void GeoData::setLineThicknessBase(float value)
 {
     m_lineThicknessBase = value;
+    m_isOverlayDirty    = true;
 }
 
 std::size_t GeoData::countLineSegmentsAscending() const
@@ -1010,7 +1534,7 @@ std::size_t GeoData::countLineSegmentsAscending() const
 
     for (const auto* entity : m_groups.linesAscending)
     {
-        for (const auto& lineString : entity->geom.lines)
+        for (const auto& lineString : m_geoData->getGeometryStore().getLines(entity->geom))
         {
             if (lineString.points.size() >= 2)
             {
@@ -1028,7 +1552,7 @@ std::size_t GeoData::countLineSegmentsDescending() const
 
     for (const auto* entity : m_groups.linesDescending)
     {
-        for (const auto& lineString : entity->geom.lines)
+        for (const auto& lineString : m_geoData->getGeometryStore().getLines(entity->geom))
         {
             if (lineString.points.size() >= 2)
             {
@@ -1046,7 +1570,9 @@ std::size_t GeoData::countAreaSegments() const
 
     for (const auto* entity : m_groups.areas)
     {
-        for (const auto& polygon : entity->geom.polygons)
+        const auto polygons = m_geoData->getGeometryStore().getPolygons(entity->geom);
+
+        for (const auto& polygon : polygons)
         {
             for (const auto& ring : polygon.rings)
             {
@@ -1057,9 +1583,9 @@ std::size_t GeoData::countAreaSegments() const
             }
         }
 
-        if (entity->geom.polygons.empty())
+        if (polygons.empty())
         {
-            for (const auto& lineString : entity->geom.lines)
+            for (const auto& lineString : m_geoData->getGeometryStore().getLines(entity->geom))
             {
                 if (lineString.points.size() >= 2)
                 {
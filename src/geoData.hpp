@@ -2,11 +2,19 @@
 #define GEODATA_HPP
 
 #include <SFML/Graphics.hpp>
+#include <future>
 #include <geoCsvParser.hpp>
+#include <loadProgress.hpp>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
 #include "heatmap.hpp"
 
 class GeoData
@@ -27,13 +35,56 @@ public:
         MultiLineString
     };
 
+    // Vertices of a line or ring in heatmap local space (cells, y down), parallel to a GeoCsvParser::PointSpan
+    struct LocalSpan
+    {
+        const sf::Vector2f* first = nullptr;
+        std::size_t         count = 0;
+
+        const sf::Vector2f* begin() const { return first; }
+        const sf::Vector2f* end() const { return first + count; }
+        std::size_t         size() const { return count; }
+        bool                empty() const { return count == 0; }
+        const sf::Vector2f& operator[](std::size_t i) const { return first[i]; }
+    };
+
+    // Contiguous run of a group, whose entities are sorted by life so every life filter selects a single run
+    struct EntitySpan
+    {
+        const GeoCsvParser::Entity* const* first = nullptr;
+        std::size_t                        count = 0;
+
+        const GeoCsvParser::Entity* const* begin() const { return first; }
+        const GeoCsvParser::Entity* const* end() const { return first + count; }
+        std::size_t                        size() const { return count; }
+        bool                               empty() const { return count == 0; }
+        const GeoCsvParser::Entity*        operator[](std::size_t i) const { return first[i]; }
+    };
+
     GeoData();
+    ~GeoData();
 
     void draw(Heatmap& heatmap, sf::RenderWindow& window);
 
+    // Converts every coordinate to heatmap local space once, so drawing and picking only apply the sprite
+    // transform. Must be called whenever the ASC or the geo dataset changes, nothing is drawn until then
+    void updateLocalCoordinates(const Heatmap& heatmap);
+    bool hasLocalCoordinates() const;
+
+    LocalSpan    getLocalSpan(GeoCsvParser::PointSpan span) const;
+    sf::Vector2f getLocalPosition(const GeoCsvParser::Entity& entity) const; // of a Point geometry
+
+    // Parsing and grouping run on a worker thread. finishLoading() swaps the result in and must be called from the
+    // render thread. It returns true on the frame a new dataset became current
     void loadData(int fileIndex);
+    bool finishLoading();
+    void cancelLoading();
     void unloadData();
 
+    bool                isLoading() const;
+    int                 getLoadingFileIndex() const;
+    const LoadProgress& getLoadProgress() const;
+
     void resetColorsToDefaults();
     void resetVisibilityToDefaults();
     void resetPointScalingToDefaults();
@@ -56,14 +107,14 @@ public:
 
     double getLifeFilterMin() const;
     double getLifeFilterMax() const;
-    void   setLifeFilterRange(double minValue, double maxValue); // clamps and recomputes in range groups
+    void   setLifeFilterRange(double minValue, double maxValue); // clamps and binary searches the in range spans
 
-    const std::vector<const GeoCsvParser::Entity*>& maximumInRange() const;
-    const std::vector<const GeoCsvParser::Entity*>& minimumInRange() const;
-    const std::vector<const GeoCsvParser::Entity*>& saddlesInRange() const;
-    const std::vector<const GeoCsvParser::Entity*>& linesAscendingInRange() const;
-    const std::vector<const GeoCsvParser::Entity*>& linesDescendingInRange() const;
-    const std::vector<const GeoCsvParser::Entity*>& areasInRange() const;
+    EntitySpan maximumInRange() const;
+    EntitySpan minimumInRange() const;
+    EntitySpan saddlesInRange() const;
+    EntitySpan linesAscendingInRange() const;
+    EntitySpan linesDescendingInRange() const;
+    EntitySpan areasInRange() const;
 
     bool getShowMaximum() const;
     bool getShowMinimum() const;
@@ -71,6 +122,7 @@ public:
     bool getShowLinesAscending() const;
     bool getShowLinesDescending() const;
     bool getShowAreas() const;
+    bool getShowAreaFill() const;
 
     void setShowMaximum(bool value);
     void setShowMinimum(bool value);
@@ -78,6 +130,7 @@ public:
     void setShowLinesAscending(bool value);
     void setShowLinesDescending(bool value);
     void setShowAreas(bool value);
+    void setShowAreaFill(bool value);
 
     DisplayMode getDisplayMode() const;
     void        setDisplayMode(DisplayMode value);
@@ -121,6 +174,26 @@ public:
     std::size_t countAreaSegments() const;
 
 private:
+    // Merged into one draw call when at most this many vertices separate two visible entities
+    static constexpr std::size_t OVERLAY_RUN_MERGE_GAP = 4096;
+
+    // Alpha of the polygon fill relative to the areas color
+    static constexpr float AREA_FILL_OPACITY = 0.35f;
+
+    // Largest distance in screen pixels between a drawn line and its full resolution path
+    static constexpr float SIMPLIFICATION_PIXELS = 0.5f;
+
+    using BPoint         = boost::geometry::model::d2::point_xy<float>;
+    using BBox           = boost::geometry::model::box<BPoint>;
+    using EntityBoxValue = std::pair<BBox, std::size_t>; // local space bounds, entity index
+    using EntityRTree    = boost::geometry::index::rtree<EntityBoxValue, boost::geometry::index::rstar<16>>;
+
+    struct VertexRange
+    {
+        std::size_t first = 0;
+        std::size_t count = 0;
+    };
+
     struct Defaults
     {
         sf::Color colorMaximum  = {255, 0, 0, 255};
@@ -136,6 +209,7 @@ private:
         bool showLinesAscending  = true;
         bool showLinesDescending = true;
         bool showAreas           = true;
+        bool showAreaFill        = true;
 
         bool  pointSizeScaleByLife = false;
         float pointSizeBase        = 8.0f;
@@ -149,12 +223,39 @@ private:
     int                           m_selectedFileIndex = -1;
     std::unique_ptr<GeoCsvParser> m_geoData;
 
+    std::vector<sf::Vector2f> m_localPoints;     // parallel to GeometryStore::points
+    std::vector<sf::Vector2f> m_localPositions;  // parallel to the entities, set for Point geometries
+    std::vector<float>        m_localImportance; // parallel to m_localPoints, see computeSimplificationImportance
+    bool                      m_hasLocalCoordinates = false;
+
+    EntityRTree              m_entityBoxes;  // every entity with coordinates, built with the local coordinates
+    std::vector<std::size_t> m_spatialRanks; // position of each entity in the tree leaves
+
+    // Triangles of the Area polygons as indices into m_localPoints, triangulated with the local coordinates
+    std::vector<uint32_t>    m_fillIndices;
+    std::vector<VertexRange> m_fillRanges; // per entity, into m_fillIndices
+
+    // Tessellated overlay in local space, drawn with the sprite transform. Rebuilt only when the data, the filter,
+    // the style settings or the sprite scale change, so panning and zooming do not touch it
+    std::vector<sf::Vertex> m_overlayVertices;
+    sf::VertexBuffer        m_overlayBuffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static};
+    sf::Shader              m_lineShader;
+    float                   m_overlayScale     = 0.0f;
+    float                   m_overlayPadding   = 0.0f; // local units
+    float                   m_overlayTolerance = 0.0f; // local units
+    bool                    m_isOverlayDirty   = true;
+
+    std::vector<VertexRange>    m_overlayRanges;     // vertices of each entity in the overlay, empty if not drawn
+    std::vector<VertexRange>    m_overlayFillRanges; // same for the polygon fills, laid out before every stroke
+    std::vector<EntityBoxValue> m_visibleBoxes;      // per frame scratch
+    std::vector<VertexRange>    m_visibleRuns;
+
     double m_lifeMin       = 0.0;
     double m_lifeMax       = 0.0;
     double m_lifeFilterMin = 0.0;
     double m_lifeFilterMax = 0.0;
 
-    // Grouped by type (pointers into m_geoData)
+    // Grouped by type (pointers into m_geoData), each group sorted by ascending life
     // (for filtering by life and counts)
     struct Groups
     {
@@ -174,7 +275,31 @@ private:
             linesDescending.clear();
             areas.clear();
         }
-    } m_groups, m_groupsInRange;
+    } m_groups;
+
+    // Life filtered part of each group
+    struct GroupSpans
+    {
+        EntitySpan maximum;
+        EntitySpan minimum;
+        EntitySpan saddles;
+        EntitySpan linesAscending;
+        EntitySpan linesDescending;
+        EntitySpan areas;
+
+        void clear() { *this = GroupSpans{}; }
+    } m_groupsInRange;
+
+    // Produced by the loader thread. The groups point into the parser, which keeps them valid when moved
+    struct LoadedData
+    {
+        std::unique_ptr<GeoCsvParser> parser;
+        Groups                        groups;
+    };
+
+    std::future<LoadedData> m_pendingLoad;
+    LoadProgress            m_loadProgress;
+    int                     m_loadingFileIndex = -1;
 
     struct Toggles
     {
@@ -184,12 +309,14 @@ private:
         bool linesAscending  = true;
         bool linesDescending = true;
         bool areas           = true;
+        bool areaFill        = true;
     } m_toggles{m_defaults.showMaximum,
                 m_defaults.showMinimum,
                 m_defaults.showSaddles,
                 m_defaults.showLinesAscending,
                 m_defaults.showLinesDescending,
-                m_defaults.showAreas};
+                m_defaults.showAreas,
+                m_defaults.showAreaFill};
 
     DisplayMode m_displayMode = DisplayMode::Lines;
 
@@ -211,8 +338,14 @@ private:
 
     void scanDataDirectory();
 
-    void groupEntities();
-    void updateLifeFilteredGroups();
+    static void  groupEntities(const GeoCsvParser& geoData, Groups& groups);
+    void         updateLifeFilteredGroups();
+    void         discardPendingLoad();
+    void         clearLocalCoordinates();
+    void         rebuildOverlay(float spriteScale, float tolerance);
+    static float getSimplificationTolerance(float pixelsPerCell); // in local units
+    std::size_t  getEntityIndex(const GeoCsvParser::Entity& entity) const;
+    LocalSpan    getEntityLocalPoints(const GeoCsvParser::Entity& entity) const;
 };
 
 #endif
\ No newline at end of file
@@ -177,13 +177,15 @@ void GridOverlay::drawGridValues(
     {
         for (int col = region.startCol; col < region.endCol; ++col)
         {
-            const float value = data->getData().at(row * header.ncols + col);
+            const std::size_t index = static_cast<std::size_t>(row) * header.ncols + col;
 
-            if (value == header.nodata_value)
+            if (data->isNoData(index))
             {
                 continue;
             }
 
+            const float value = static_cast<float>(data->getValue(index));
+
             // Use the same stringstream to avoid per cell allocations
             oss.str({});
             oss.clear();
@@ -1,12 +1,22 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 
+#include "colormaps.hpp"
 #include "geoUtils.hpp"
 #include "heatmap.hpp"
 
 #define GL_R32F 0x822E // Should be imported by glad. Decide later to import the whole lib or not
 
-Heatmap::Heatmap() : m_heatmapSprite(m_heatmapTexture)
+// Tile edge in cells. Lower than most GL_MAX_TEXTURE_SIZE values so tiles can also be culled on smaller grids
+static constexpr unsigned MAX_TILE_SIZE = 4096;
+
+// Texels per colormap row. Linear filtering between them reproduces the piecewise linear interpolation of the stops
+static constexpr unsigned COLORMAP_LUT_WIDTH = 256;
+
+Heatmap::Heatmap() : m_heatmapSprite(m_frameTexture)
 {
     scanDataDirectory();
 
@@ -17,15 +27,23 @@ Heatmap::Heatmap() : m_heatmapSprite(m_heatmapTexture)
     {
         throw std::runtime_error("Failed to load heatmap shader.");
     }
+
+    buildColormapLut();
+    setCurrentColormapID(m_currentColormapID);
 }
 
 Heatmap::~Heatmap()
 {
+    discardPendingLoad();
+
     // Handle this because of float data custom implementation
-    if (m_heatmapTexture.getNativeHandle() != 0)
+    for (const Tile& tile : m_tiles)
     {
-        GLuint handle = m_heatmapTexture.getNativeHandle();
-        glDeleteTextures(1, &handle);
+        if (tile.texture.getNativeHandle() != 0)
+        {
+            GLuint handle = tile.texture.getNativeHandle();
+            glDeleteTextures(1, &handle);
+        }
     }
 }
 
@@ -39,6 +57,44 @@ void Heatmap::draw(const sf::View& view)
     calculateAutoClamp(view);
 }
 
+void Heatmap::drawTiles(sf::RenderTarget& target)
+{
+    if (!m_ascData || m_tiles.empty())
+    {
+        return;
+    }
+
+    const GeoUtils::VisibleArea visibleArea = GeoUtils::getVisibleAreaInLocalCoords(target.getView(), m_heatmapSprite);
+
+    if (!visibleArea.isValid)
+    {
+        return;
+    }
+
+    for (const Tile& tile : m_tiles)
+    {
+        const float tileLeft   = static_cast<float>(tile.origin.x);
+        const float tileTop    = static_cast<float>(tile.origin.y);
+        const float tileRight  = tileLeft + static_cast<float>(tile.size.x);
+        const float tileBottom = tileTop + static_cast<float>(tile.size.y);
+
+        if (tileRight <= visibleArea.left || tileLeft >= visibleArea.right || tileBottom <= visibleArea.top ||
+            tileTop >= visibleArea.bottom)
+        {
+            continue;
+        }
+
+        // Each tile sits at its cell offset inside the shared grid space
+        sf::Sprite tileSprite(tile.texture);
+        tileSprite.setPosition({tileLeft, tileTop});
+
+        sf::RenderStates states(&m_heatmapShader);
+        states.transform = m_heatmapSprite.getTransform();
+
+        target.draw(tileSprite, states);
+    }
+}
+
 void Heatmap::loadData(int fileIndex)
 {
     if (fileIndex < 0 || fileIndex >= m_dataFiles.size())
@@ -46,14 +102,48 @@ void Heatmap::loadData(int fileIndex)
         return;
     }
 
-    m_selectedFileIndex         = fileIndex;
-    const std::string& filename = m_dataFiles[m_selectedFileIndex];
+    discardPendingLoad();
+
+    const std::string dataFolderPath = ASC_DATA_PATH;
+    const std::string filepath       = dataFolderPath + "/" + m_dataFiles[fileIndex];
+
+    // Float storage is what the texture needs, so it can be uploaded without any conversion
+    AscParser::LoadOptions options;
+    options.mode           = AscParser::LoadMode::Parallel;
+    options.precision      = AscParser::Precision::Float;
+    options.useBinaryCache = true;
+    options.progress       = &m_loadProgress;
+
+    m_loadProgress.reset();
+    m_loadingFileIndex = fileIndex;
+    m_pendingLoad      = std::async(std::launch::async,
+                                    [filepath, options]()
+                                    {
+                                        LoadedData loaded;
+                                        loaded.ascData       = std::make_unique<AscParser>(filepath, options);
+                                        loaded.minMaxPyramid = std::make_unique<MinMaxPyramid>(*loaded.ascData);
+
+                                        return loaded;
+                                    });
+}
+
+bool Heatmap::finishLoading()
+{
+    if (!isLoading() || m_pendingLoad.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+
+    const int fileIndex = m_loadingFileIndex;
+    m_loadingFileIndex  = -1;
 
     try
     {
-        const std::string dataFolderPath = ASC_DATA_PATH;
-        std::string       filepath       = dataFolderPath + "/" + filename;
-        m_ascData                        = std::make_unique<AscParser>(filepath);
+        LoadedData loaded = m_pendingLoad.get();
+
+        m_minMaxPyramid     = std::move(loaded.minMaxPyramid);
+        m_ascData           = std::move(loaded.ascData);
+        m_selectedFileIndex = fileIndex;
 
         m_globalMin = static_cast<float>(m_ascData->getMinValue());
         m_globalMax = static_cast<float>(m_ascData->getMaxValue());
@@ -66,15 +156,63 @@ void Heatmap::loadData(int fileIndex)
         m_heatmapShader.setUniform("uFloatTexture", sf::Shader::CurrentTexture);
 
         updateHeatmapTexture();
+    } catch (const LoadCancelled&)
+    {
+        // Keep whatever was shown before the load started
+        return false;
     } catch (const std::runtime_error& e)
     {
         std::cerr << "Failed to load ASC data: " << e.what() << std::endl;
+        m_minMaxPyramid.reset();
         m_ascData.reset();
+        m_selectedFileIndex = fileIndex;
+    }
+
+    return true;
+}
+
+void Heatmap::cancelLoading()
+{
+    if (isLoading())
+    {
+        m_loadProgress.cancel();
+    }
+}
+
+// Cancels and joins the worker. The parsers poll cancellation often, so this does not block for long
+void Heatmap::discardPendingLoad()
+{
+    if (!isLoading())
+    {
+        return;
     }
+
+    m_loadProgress.cancel();
+    m_pendingLoad.wait();
+    m_pendingLoad      = {};
+    m_loadingFileIndex = -1;
+}
+
+bool Heatmap::isLoading() const
+{
+    return m_pendingLoad.valid();
+}
+
+int Heatmap::getLoadingFileIndex() const
+{
+    return m_loadingFileIndex;
+}
+
+const LoadProgress& Heatmap::getLoadProgress() const
+{
+    return m_loadProgress;
 }
 
 void Heatmap::unloadData()
 {
+    discardPendingLoad();
+
+    m_minMaxPyramid.reset();
     m_ascData.reset();
     m_selectedFileIndex = -1;
 
@@ -105,7 +243,46 @@ void Heatmap::resetAscSettingsToDefaults()
 void Heatmap::setCurrentColormapID(int id)
 {
     m_currentColormapID = id;
-    m_heatmapShader.setUniform("uColormapID", m_currentColormapID);
+
+    // Sample the middle of the row so vertical filtering never blends in the neighbouring colormaps
+    const float rowCount = static_cast<float>(COLORMAP_NAMES.size());
+    m_heatmapShader.setUniform("uColormapRow", (static_cast<float>(m_currentColormapID) + 0.5f) / rowCount);
+}
+
+void Heatmap::buildColormapLut()
+{
+    const unsigned rowCount = static_cast<unsigned>(COLORMAP_NAMES.size());
+
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(COLORMAP_LUT_WIDTH) * rowCount * 4);
+
+    for (unsigned row = 0; row < rowCount; ++row)
+    {
+        const auto& stops = Colormaps::getStops(COLORMAP_NAMES[row]);
+
+        for (unsigned i = 0; i < COLORMAP_LUT_WIDTH; ++i)
+        {
+            const float            v     = static_cast<float>(i) / static_cast<float>(COLORMAP_LUT_WIDTH - 1);
+            const Colormaps::Color color = Colormaps::sample(stops, v);
+            std::uint8_t*          texel = &pixels[(static_cast<std::size_t>(row) * COLORMAP_LUT_WIDTH + i) * 4];
+
+            for (int c = 0; c < 3; ++c)
+            {
+                texel[c] = static_cast<std::uint8_t>(std::lround(std::clamp(color[c], 0.0f, 1.0f) * 255.0f));
+            }
+            texel[3] = 255;
+        }
+    }
+
+    if (!m_colormapLut.resize({COLORMAP_LUT_WIDTH, rowCount}))
+    {
+        throw std::runtime_error("Failed to create colormap lookup texture.");
+    }
+
+    m_colormapLut.update(pixels.data());
+    m_colormapLut.setSmooth(true);
+
+    m_heatmapShader.setUniform("uColormapLut", m_colormapLut);
+    m_heatmapShader.setUniform("uColormapLutWidth", static_cast<float>(COLORMAP_LUT_WIDTH));
 }
 
 void Heatmap::updateHeatmapView(sf::View view)
@@ -115,8 +292,8 @@ void Heatmap::updateHeatmapView(sf::View view)
         return;
     }
 
-    const sf::Vector2f textureSize(m_heatmapTexture.getSize());
-    const sf::Vector2f viewSize = view.getSize();
+    const sf::Vector2f textureSize = m_heatmapSprite.getLocalBounds().size; // ncols x nrows
+    const sf::Vector2f viewSize    = view.getSize();
 
     // Calculate the scale factor to fit the texture within the view while preserving aspect ratio
     float scaleX = viewSize.x / textureSize.x;
@@ -153,11 +330,6 @@ int Heatmap::getCurrentColormapID() const
     return m_currentColormapID;
 }
 
-const sf::Texture& Heatmap::getHeatmapTexture() const
-{
-    return m_heatmapTexture;
-}
-
 const sf::Sprite& Heatmap::getHeatmapSprite() const
 {
     return m_heatmapSprite;
@@ -168,6 +340,11 @@ sf::Shader& Heatmap::getHeatmapShader()
     return m_heatmapShader;
 }
 
+std::size_t Heatmap::getTileCount() const
+{
+    return m_tiles.size();
+}
+
 bool Heatmap::isAutoClamping() const
 {
     return m_isAutoClamping;
@@ -234,30 +411,59 @@ void Heatmap::updateHeatmapTexture()
         return;
     }
 
-    const auto&        header     = m_ascData->getHeader();
-    const auto&        doubleData = m_ascData->getData();
-    std::vector<float> floatData(doubleData.begin(), doubleData.end());
+    const auto& header = m_ascData->getHeader();
 
-    const sf::Vector2u newSize{static_cast<unsigned>(header.ncols), static_cast<unsigned>(header.nrows)};
+    // Float grids are uploaded straight from the parser storage. Only double grids need a converted copy
+    std::vector<float> convertedData;
+    const float*       floatData = m_ascData->getFloatData();
 
-    if (m_heatmapTexture.getSize() != newSize)
+    if (!floatData)
     {
-        if (!m_heatmapTexture.resize(newSize))
-        {
-            throw std::runtime_error("Failed to resize heatmap texture");
-        }
+        const double* doubleData = m_ascData->getDoubleData();
+        convertedData.assign(doubleData, doubleData + m_ascData->getCellCount());
+        floatData = convertedData.data();
     }
 
-    GLuint handle = m_heatmapTexture.getNativeHandle();
-    glBindTexture(GL_TEXTURE_2D, handle);
+    const int tileSize = static_cast<int>(std::min(MAX_TILE_SIZE, sf::Texture::getMaximumSize()));
+    const int tilesX   = (header.ncols + tileSize - 1) / tileSize;
+    const int tilesY   = (header.nrows + tileSize - 1) / tileSize;
 
-    // Upload the float data. GL_R32F is the internal format for a single 32bit float channel.
-    // Reference at https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, header.ncols, header.nrows, 0, GL_RED, GL_FLOAT, floatData.data());
+    m_tiles.clear();
+    m_tiles.resize(static_cast<std::size_t>(tilesX) * tilesY);
+
+    // Each tile reads its sub rectangle straight out of the row major grid
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, header.ncols);
+
+    for (int ty = 0; ty < tilesY; ++ty)
+    {
+        for (int tx = 0; tx < tilesX; ++tx)
+        {
+            Tile& tile  = m_tiles[static_cast<std::size_t>(ty) * tilesX + tx];
+            tile.origin = {tx * tileSize, ty * tileSize};
+            tile.size.x = std::min(tileSize, header.ncols - tile.origin.x);
+            tile.size.y = std::min(tileSize, header.nrows - tile.origin.y);
+
+            if (!tile.texture.resize({static_cast<unsigned>(tile.size.x), static_cast<unsigned>(tile.size.y)}))
+            {
+                glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+                throw std::runtime_error("Failed to resize heatmap texture");
+            }
+
+            const float* tileData = floatData + static_cast<std::size_t>(tile.origin.y) * header.ncols + tile.origin.x;
+
+            GLuint handle = tile.texture.getNativeHandle();
+            glBindTexture(GL_TEXTURE_2D, handle);
+
+            // Upload the float data. GL_R32F is the internal format for a single 32bit float channel.
+            // Reference at https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, tile.size.x, tile.size.y, 0, GL_RED, GL_FLOAT, tileData);
+        }
+    }
 
     glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 
-    m_heatmapSprite.setTexture(m_heatmapTexture, true);
+    m_heatmapSprite.setTextureRect(sf::IntRect({0, 0}, {header.ncols, header.nrows}));
 }
 
 void Heatmap::setAutoClamp(bool enabled)
@@ -315,10 +521,6 @@ void Heatmap::calculateAutoClamp(const sf::View& view)
     const float top    = visibleArea.top;
     const float bottom = visibleArea.bottom;
 
-    const sf::Vector2u textureSize = m_heatmapTexture.getSize(); // ncols x nrows
-    const float        maxX        = static_cast<float>(textureSize.x);
-    const float        maxY        = static_cast<float>(textureSize.y);
-
     if (right <= left || bottom <= top)
     {
         m_currentClampMin = m_globalMin;
@@ -344,40 +546,11 @@ void Heatmap::calculateAutoClamp(const sf::View& view)
         return;
     }
 
-    const auto&  data   = m_ascData->getData();
-    const double nodata = header.nodata_value;
-
-    float localMin    = std::numeric_limits<float>::max();
-    float localMax    = std::numeric_limits<float>::lowest();
-    bool  hasAnyValue = false;
+    float localMin = std::numeric_limits<float>::max();
+    float localMax = std::numeric_limits<float>::lowest();
 
-    // Scan the visible cells to find local min/max
-    for (int r = startRow; r < endRow; ++r)
-    {
-        const std::size_t base = static_cast<std::size_t>(r) * ncols;
-
-        for (int c = startCol; c < endCol; ++c)
-        {
-            const double value = data[base + c];
-            if (value == nodata)
-            {
-                continue;
-            }
-
-            hasAnyValue            = true;
-            const float floatValue = static_cast<float>(value);
-
-            if (floatValue < localMin)
-            {
-                localMin = floatValue;
-            }
-
-            if (floatValue > localMax)
-            {
-                localMax = floatValue;
-            }
-        }
-    }
+    // Only the border of the visible rectangle is scanned cell by cell, the rest comes from the pyramid
+    const bool hasAnyValue = m_minMaxPyramid->query(startCol, endCol, startRow, endRow, localMin, localMax);
 
     if (!hasAnyValue)
     {
@@ -4,7 +4,10 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/OpenGL.hpp>
 #include <ascParser.hpp>
+#include <future>
+#include <loadProgress.hpp>
 #include <memory>
+#include <minMaxPyramid.hpp>
 #include <string>
 #include <vector>
 
@@ -18,9 +21,19 @@ public:
     ~Heatmap();
 
     void draw(const sf::View& view);
+    void drawTiles(sf::RenderTarget& target);
 
+    // Parsing runs on a worker thread. finishLoading() swaps the result in and uploads the texture, so it has to be
+    // called from the render thread. It returns true on the frame a new dataset became current
     void loadData(int fileIndex);
+    bool finishLoading();
+    void cancelLoading();
     void unloadData();
+
+    bool                isLoading() const;
+    int                 getLoadingFileIndex() const;
+    const LoadProgress& getLoadProgress() const;
+
     void resetAscSettingsToDefaults();
 
     void setCurrentColormapID(int id);
@@ -36,9 +49,11 @@ public:
     int getSelectedFileIndex() const;
     int getCurrentColormapID() const;
 
-    const sf::Texture& getHeatmapTexture() const;
-    const sf::Sprite&  getHeatmapSprite() const;
-    sf::Shader&        getHeatmapShader();
+    // Placement of the whole grid. Local coordinates are cells (ncols x nrows) and every tile, overlay and picking
+    // query shares them. The sprite itself is never drawn, only its transform and bounds are used
+    const sf::Sprite& getHeatmapSprite() const;
+    sf::Shader&       getHeatmapShader();
+    std::size_t       getTileCount() const;
 
     bool  isAutoClamping() const;
     float getGlobalMin() const;
@@ -49,15 +64,37 @@ public:
     float getCurrentClampMax() const;
 
 private:
-    std::unique_ptr<AscParser> m_ascData;
-    std::vector<std::string>   m_dataFiles;
+    std::unique_ptr<AscParser>     m_ascData;
+    std::unique_ptr<MinMaxPyramid> m_minMaxPyramid; // refers to m_ascData, auto clamp queries
+    std::vector<std::string>       m_dataFiles;
+
+    // Produced by the loader thread, the pyramid is built there right after parsing
+    struct LoadedData
+    {
+        std::unique_ptr<AscParser>     ascData;
+        std::unique_ptr<MinMaxPyramid> minMaxPyramid;
+    };
+
+    std::future<LoadedData> m_pendingLoad;
+    LoadProgress            m_loadProgress;
+    int                     m_loadingFileIndex = -1;
 
     int m_selectedFileIndex = -1;
     int m_currentColormapID = 0;
 
-    sf::Texture m_heatmapTexture; // Float asc data
-    sf::Sprite  m_heatmapSprite;
-    sf::Shader  m_heatmapShader;
+    // Grids wider or taller than GL_MAX_TEXTURE_SIZE do not fit in one texture, so they are split in square tiles
+    struct Tile
+    {
+        sf::Texture  texture; // Float asc data
+        sf::Vector2i origin;  // first cell covered, in grid coordinates
+        sf::Vector2i size;    // cells covered
+    };
+
+    std::vector<Tile> m_tiles;
+    sf::Texture       m_frameTexture; // empty, sf::Sprite needs one to exist
+    sf::Sprite        m_heatmapSprite;
+    sf::Shader        m_heatmapShader;
+    sf::Texture       m_colormapLut; // one row per entry of COLORMAP_NAMES
 
     bool  m_isAutoClamping  = false;
     float m_globalMin       = 0.f;
@@ -69,6 +106,8 @@ private:
 
     void scanDataDirectory();
     void updateHeatmapTexture();
+    void buildColormapLut();
+    void discardPendingLoad();
 };
 
 #endif
\ No newline at end of file
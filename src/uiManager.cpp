@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <imgui.h>
 
 #include "cellTooltip.hpp"
@@ -53,6 +54,27 @@ static bool leftIconRightButton(const char* id, const char* tooltip, const char*
     return pressed;
 }
 
+// Progress of a background load with a cancel button on the same line. Returns true if cancel was pressed
+static bool loadProgressBar(const char* id, const LoadProgress& progress)
+{
+    const ImGuiStyle& style       = ImGui::GetStyle();
+    const float       cancelWidth = ImGui::CalcTextSize("Cancel").x + style.FramePadding.x * 2.0f;
+    const float       barWidth    = ImGui::GetContentRegionAvail().x - cancelWidth - style.ItemInnerSpacing.x;
+    const float       fraction    = progress.getFraction();
+
+    char overlay[32];
+    std::snprintf(overlay, sizeof(overlay), "Loading... %.0f%%", fraction * 100.0f);
+
+    ImGui::ProgressBar(fraction, ImVec2(barWidth, 0.0f), overlay);
+    ImGui::SameLine(0.0f, style.ItemInnerSpacing.x);
+
+    ImGui::PushID(id);
+    bool pressed = ImGui::Button("Cancel");
+    ImGui::PopID();
+
+    return pressed;
+}
+
 static ImVec4 toImVec4FromColor(sf::Color color)
 {
     return ImVec4(color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f);
@@ -67,6 +89,22 @@ static sf::Color fromImVec4ToColor(const ImVec4& vec)
 
 void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellTooltip, GridOverlay& gridOverlay)
 {
+    // Loads started from the combos below complete here, on the render thread
+    if (heatmap.finishLoading())
+    {
+        heatmap.updateHeatmapView(m_view);
+        geoData.updateLocalCoordinates(heatmap);
+        cellTooltip.rebuildSpatialIndex(heatmap, geoData);
+    }
+
+    if (geoData.finishLoading())
+    {
+        geoData.updateLocalCoordinates(heatmap);
+        cellTooltip.rebuildSpatialIndex(heatmap, geoData);
+    }
+
+    cellTooltip.finishBuildingSpatialIndex();
+
     const float          initialWidth = 380.0f;
     const ImGuiViewport* viewport     = ImGui::GetMainViewport();
     ImVec2               window_pos(viewport->WorkPos.x + viewport->WorkSize.x, viewport->WorkPos.y);
@@ -103,7 +141,7 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
     if (unloadAscPressed && hasAsc)
     {
         heatmap.unloadData();
-        cellTooltip.hide();
+        cellTooltip.rebuildSpatialIndex(heatmap, geoData);
     }
 
 
@@ -118,11 +156,9 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
             const bool is_selected = (selectedFileIndex == i);
             if (ImGui::Selectable(dataFiles[i].c_str(), is_selected))
             {
-                if (selectedFileIndex != i)
+                if (selectedFileIndex != i && heatmap.getLoadingFileIndex() != i)
                 {
                     heatmap.loadData(i);
-                    heatmap.updateHeatmapView(m_view);
-                    cellTooltip.rebuildSpatialIndex(heatmap, geoData);
                 }
             }
             if (is_selected)
@@ -131,6 +167,11 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
         ImGui::EndCombo();
     }
 
+    if (heatmap.isLoading() && loadProgressBar("asc-load-cancel", heatmap.getLoadProgress()))
+    {
+        heatmap.cancelLoading();
+    }
+
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
@@ -140,12 +181,15 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
         ImGui::Text("File Information:");
 
         const auto& header         = heatmap.getAscData()->getHeader();
+        const auto& statistics     = heatmap.getAscData()->getStatistics();
         const auto  globalMinValue = heatmap.getAscData()->getMinValue();
         const auto  globalMaxValue = heatmap.getAscData()->getMaxValue();
 
         ImGui::Text("  - Dimensions: %d x %d", header.ncols, header.nrows);
         ImGui::Text("  - Cell Size: %.3f", header.cellsize);
         ImGui::Text("  - Min/Max: %.3f / %.3f", globalMinValue, globalMaxValue);
+        ImGui::Text("  - Mean: %.3f", statistics.mean());
+        ImGui::Text("  - No data cells: %zu", statistics.nodataCount);
 
         ImGui::Spacing();
         ImGui::Separator();
@@ -249,7 +293,7 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
         if (iconRightButton("reset-geo-dataset", "Unload Geo data", u8"x"))
         {
             geoData.unloadData();
-            cellTooltip.hide();
+            cellTooltip.rebuildSpatialIndex(heatmap, geoData);
         }
 
         if (!hasGeoData)
@@ -271,10 +315,9 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
 
             if (ImGui::Selectable(geoFiles[i].c_str(), is_selected))
             {
-                if (selectedGeoFileIndex != i)
+                if (selectedGeoFileIndex != i && geoData.getLoadingFileIndex() != i)
                 {
                     geoData.loadData(i);
-                    cellTooltip.rebuildSpatialIndex(heatmap, geoData);
                 }
             }
 
@@ -287,6 +330,11 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
         ImGui::EndCombo();
     }
 
+    if (geoData.isLoading() && loadProgressBar("geo-load-cancel", geoData.getLoadProgress()))
+    {
+        geoData.cancelLoading();
+    }
+
     if (geoData.getGeoData())
     {
         ImGui::Spacing();
@@ -318,6 +366,12 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
             geoData.setLifeFilterRange(lifeMin, lifeMax);
         }
 
+        bool isHoverPicking = cellTooltip.getHoverPicking();
+        if (ImGui::Checkbox("Pick on hover", &isHoverPicking))
+        {
+            cellTooltip.setHoverPicking(isHoverPicking);
+        }
+
         // Display mode
         ImGui::Spacing();
         ImGui::Separator();
@@ -440,6 +494,12 @@ void UIManager::draw(Heatmap& heatmap, GeoData& geoData, CellTooltip& cellToolti
             geoData.setShowAreas(showAreas);
         }
 
+        bool showAreaFill = geoData.getShowAreaFill();
+        if (ImGui::Checkbox("Fill polygons", &showAreaFill))
+        {
+            geoData.setShowAreaFill(showAreaFill);
+        }
+
         if (areasDisabled)
         {
             ImGui::EndDisabled();
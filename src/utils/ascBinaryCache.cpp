@@ -0,0 +1,191 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "ascBinaryCache.hpp"
+
+namespace
+{
+constexpr char          MAGIC[4] = {'A', 'S', 'C', 'B'};
+constexpr std::uint32_t VERSION  = 2;
+
+// Fixed size so the cells that follow it stay aligned in the mapping
+struct FileHeader
+{
+    char          magic[4];
+    std::uint32_t version;
+    std::uint64_t sourceSize;
+    std::int64_t  sourceMtime;
+    std::int32_t  ncols;
+    std::int32_t  nrows;
+    double        xllcorner;
+    double        yllcorner;
+    double        cellsize;
+    double        nodataValue;
+    double        min;
+    double        max;
+    double        sum;
+    std::uint64_t validCount;
+    std::uint64_t nodataCount;
+    std::uint64_t cellCount;
+    std::uint64_t reserved[2];
+};
+
+static_assert(sizeof(FileHeader) == 128, "FileHeader layout must stay fixed");
+} // namespace
+
+namespace AscBinaryCache
+{
+bool getSourceStamp(const std::string& sourcePath, SourceStamp& outStamp)
+{
+    std::error_code error;
+
+    const auto size = std::filesystem::file_size(sourcePath, error);
+    if (error)
+    {
+        return false;
+    }
+
+    const auto mtime = std::filesystem::last_write_time(sourcePath, error);
+    if (error)
+    {
+        return false;
+    }
+
+    outStamp.size  = static_cast<std::uint64_t>(size);
+    outStamp.mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+
+    return true;
+}
+
+std::string getCachePath(const std::string& sourcePath, const std::string& cacheDirectory)
+{
+    std::filesystem::path cachePath(sourcePath);
+    cachePath.replace_extension(".ascb");
+
+    if (!cacheDirectory.empty())
+    {
+        cachePath = std::filesystem::path(cacheDirectory) / cachePath.filename();
+    }
+
+    return cachePath.string();
+}
+
+bool open(const std::string& cachePath, const SourceStamp& stamp, MappedFile& outMapping, Contents& outContents)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(cachePath, error))
+    {
+        return false;
+    }
+
+    MappedFile mapping;
+
+    try
+    {
+        mapping = MappedFile(cachePath);
+    } catch (const std::runtime_error&)
+    {
+        return false;
+    }
+
+    if (mapping.size() < sizeof(FileHeader))
+    {
+        return false;
+    }
+
+    FileHeader fileHeader;
+    std::memcpy(&fileHeader, mapping.data(), sizeof(fileHeader));
+
+    const bool isCurrent = std::memcmp(fileHeader.magic, MAGIC, sizeof(MAGIC)) == 0 && fileHeader.version == VERSION &&
+                           fileHeader.sourceSize == stamp.size && fileHeader.sourceMtime == stamp.mtime;
+
+    if (!isCurrent || fileHeader.ncols <= 0 || fileHeader.nrows <= 0)
+    {
+        return false;
+    }
+
+    const std::uint64_t expectedCells = static_cast<std::uint64_t>(fileHeader.ncols) * fileHeader.nrows;
+    if (fileHeader.cellCount != expectedCells ||
+        mapping.size() != sizeof(FileHeader) + expectedCells * sizeof(float))
+    {
+        return false;
+    }
+
+    outContents.header.ncols        = fileHeader.ncols;
+    outContents.header.nrows        = fileHeader.nrows;
+    outContents.header.xllcorner    = fileHeader.xllcorner;
+    outContents.header.yllcorner    = fileHeader.yllcorner;
+    outContents.header.cellsize     = fileHeader.cellsize;
+    outContents.header.nodata_value = fileHeader.nodataValue;
+
+    outContents.statistics.min         = fileHeader.min;
+    outContents.statistics.max         = fileHeader.max;
+    outContents.statistics.sum         = fileHeader.sum;
+    outContents.statistics.validCount  = static_cast<std::size_t>(fileHeader.validCount);
+    outContents.statistics.nodataCount = static_cast<std::size_t>(fileHeader.nodataCount);
+
+    outContents.cells = reinterpret_cast<const float*>(mapping.data() + sizeof(FileHeader));
+    outMapping        = std::move(mapping);
+
+    return true;
+}
+
+void write(const std::string&           cachePath,
+           const SourceStamp&           stamp,
+           const AscParser::Header&     header,
+           const AscParser::Statistics& statistics,
+           const float*                 cells,
+           std::size_t                  cellCount)
+{
+    FileHeader fileHeader{};
+    std::memcpy(fileHeader.magic, MAGIC, sizeof(MAGIC));
+    fileHeader.version     = VERSION;
+    fileHeader.sourceSize  = stamp.size;
+    fileHeader.sourceMtime = stamp.mtime;
+    fileHeader.ncols       = header.ncols;
+    fileHeader.nrows       = header.nrows;
+    fileHeader.xllcorner   = header.xllcorner;
+    fileHeader.yllcorner   = header.yllcorner;
+    fileHeader.cellsize    = header.cellsize;
+    fileHeader.nodataValue = header.nodata_value;
+    fileHeader.min         = statistics.min;
+    fileHeader.max         = statistics.max;
+    fileHeader.sum         = statistics.sum;
+    fileHeader.validCount  = statistics.validCount;
+    fileHeader.nodataCount = statistics.nodataCount;
+    fileHeader.cellCount   = cellCount;
+
+    const std::filesystem::path finalPath(cachePath);
+    const std::filesystem::path tempPath = finalPath.string() + ".tmp";
+
+    if (finalPath.has_parent_path())
+    {
+        std::filesystem::create_directories(finalPath.parent_path());
+    }
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            throw std::runtime_error("Could not create file: " + tempPath.string());
+        }
+
+        out.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+        out.write(reinterpret_cast<const char*>(cells), static_cast<std::streamsize>(cellCount * sizeof(float)));
+
+        if (!out)
+        {
+            out.close();
+
+            std::error_code error;
+            std::filesystem::remove(tempPath, error);
+            throw std::runtime_error("Could not write file: " + tempPath.string());
+        }
+    }
+
+    std::filesystem::rename(tempPath, finalPath);
+}
+} // namespace AscBinaryCache
@@ -0,0 +1,47 @@
+#ifndef ASC_BINARY_CACHE_HPP
+#define ASC_BINARY_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ascParser.hpp"
+#include "mappedFile.hpp"
+
+// Binary sidecar (.ascb) of a parsed ASC grid: header, statistics and float32 cells.
+// It is bound to its source file through size and modification time. Hashing the source on every load would cost
+// as much as parsing it, so an edit that keeps both unchanged goes unnoticed
+namespace AscBinaryCache
+{
+struct SourceStamp
+{
+    std::uint64_t size  = 0;
+    std::int64_t  mtime = 0;
+};
+
+struct Contents
+{
+    AscParser::Header     header;
+    AscParser::Statistics statistics;
+    const float*          cells = nullptr; // points into the mapping passed to open()
+};
+
+// Returns false if the source file cannot be inspected, in which case the cache must not be used
+bool getSourceStamp(const std::string& sourcePath, SourceStamp& outStamp);
+
+// <cacheDirectory>/<name>.ascb, or <name>.ascb next to the source when cacheDirectory is empty
+std::string getCachePath(const std::string& sourcePath, const std::string& cacheDirectory);
+
+// Maps the cache and validates it against the source stamp. Returns false if it is missing, malformed or stale
+bool open(const std::string& cachePath, const SourceStamp& stamp, MappedFile& outMapping, Contents& outContents);
+
+// Writes to a temporary file first and renames it, so readers never see a partial cache. Throws on I/O errors
+void write(const std::string&           cachePath,
+           const SourceStamp&           stamp,
+           const AscParser::Header&     header,
+           const AscParser::Statistics& statistics,
+           const float*                 cells,
+           std::size_t                  cellCount);
+} // namespace AscBinaryCache
+
+#endif
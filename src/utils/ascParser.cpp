@@ -1,81 +1,371 @@
 #include <algorithm>
 #include <cctype>
-#include <fstream>
+#include <charconv>
+#include <cstdint>
 #include <iostream>
 #include <limits>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
+#include "ascBinaryCache.hpp"
 #include "ascParser.hpp"
+#include "mappedFile.hpp"
+#include "runOnThreads.hpp"
 
-static std::string toLower(const std::string& str)
+static bool equalsIgnoreCase(std::string_view str, std::string_view lowerKey)
 {
-    std::string lower_str = str;
+    if (str.size() != lowerKey.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < str.size(); ++i)
+    {
+        if (std::tolower(static_cast<unsigned char>(str[i])) != lowerKey[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool isSpace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
 
-    for (char& c : lower_str)
+static const char* skipSpaces(const char* cursor, const char* end)
+{
+    while (cursor < end && isSpace(*cursor))
     {
-        c = std::tolower(c);
+        ++cursor;
     }
 
-    return lower_str;
+    return cursor;
 }
 
-AscParser::AscParser(const std::string& filepath)
+// Returns the next whitespace delimited token in [cursor, lineEnd) and moves cursor past it
+static std::string_view nextToken(const char*& cursor, const char* lineEnd)
 {
-    loadFile(filepath);
-    findMinMax();
+    cursor            = skipSpaces(cursor, lineEnd);
+    const char* start = cursor;
+
+    while (cursor < lineEnd && !isSpace(*cursor))
+    {
+        ++cursor;
+    }
+
+    return std::string_view(start, static_cast<std::size_t>(cursor - start));
 }
 
-void AscParser::loadFile(const std::string& filepath)
+// std::from_chars does not accept a leading '+' while stream extraction does, so skip it here
+template <typename T>
+static const char* parseNumber(const char* first, const char* last, T& out)
 {
-    std::ifstream file(filepath);
-    if (!file.is_open())
+    if (first < last && *first == '+')
     {
-        throw std::runtime_error("Could not open file: " + filepath);
+        ++first;
     }
 
-    std::string   line;
-    std::string   key;
+    const auto [ptr, ec] = std::from_chars(first, last, out);
+
+    return (ec == std::errc()) ? ptr : nullptr;
+}
+
+template <typename T>
+static void parseHeaderValue(std::string_view token, T& out)
+{
+    // Same as the previous stream based reader: a malformed value leaves the default untouched
+    parseNumber(token.data(), token.data() + token.size(), out);
+}
+
+// Scans whitespace separated values in [cursor, end) and stores them from out[firstIndex] on. Values past capacity
+// are only counted so the caller can report them. Scanning stops at the first token that is not exactly one number,
+// so a token never yields more than one value (stream extraction would read "1-2" as 1 and -2) and the parallel
+// parse can place its chunks by counting tokens. Statistics are gathered in the same pass. Returns the number of
+// values read
+// Progress is published every PROGRESS_STRIDE bytes, which is also how often cancellation is polled. A cancelled
+// scan returns early with a short count, the caller is expected to check the progress and throw
+template <typename T>
+static std::size_t parseBodyRange(const char*            cursor,
+                                  const char*            end,
+                                  T*                     out,
+                                  std::size_t            firstIndex,
+                                  std::size_t            capacity,
+                                  double                 nodata,
+                                  AscParser::Statistics& stats,
+                                  LoadProgress*          progress)
+{
+    const std::ptrdiff_t PROGRESS_STRIDE = 1 << 20;
+
+    std::size_t index      = firstIndex;
+    const char* reported   = cursor;
+    const char* nextReport = cursor + std::min(PROGRESS_STRIDE, end - cursor);
+
+    while ((cursor = skipSpaces(cursor, end)) < end)
+    {
+        double      value;
+        const char* next = parseNumber(cursor, end, value);
+
+        if (!next || (next < end && !isSpace(*next)))
+        {
+            break;
+        }
+
+        if (index < capacity)
+        {
+            out[index] = static_cast<T>(value);
+        }
+
+        if (value == nodata)
+        {
+            ++stats.nodataCount;
+        }
+        else
+        {
+            stats.min = std::min(stats.min, value);
+            stats.max = std::max(stats.max, value);
+            stats.sum += value;
+            ++stats.validCount;
+        }
+
+        ++index;
+        cursor = next;
+
+        if (progress && cursor >= nextReport)
+        {
+            progress->advance(static_cast<std::size_t>(cursor - reported));
+            reported   = cursor;
+            nextReport = cursor + std::min(PROGRESS_STRIDE, end - cursor);
+
+            if (progress->isCancelled())
+            {
+                break;
+            }
+        }
+    }
+
+    if (progress && !progress->isCancelled())
+    {
+        progress->advance(static_cast<std::size_t>(end - reported));
+    }
+
+    return index - firstIndex;
+}
+
+static void throwIfCancelled(const LoadProgress* progress)
+{
+    if (progress && progress->isCancelled())
+    {
+        throw LoadCancelled();
+    }
+}
+
+static std::size_t countTokens(const char* cursor, const char* end)
+{
+    std::size_t count   = 0;
+    bool        inToken = false;
+
+    for (; cursor < end; ++cursor)
+    {
+        const bool space = isSpace(*cursor);
+        count += (!space && !inToken) ? 1 : 0;
+        inToken = !space;
+    }
+
+    return count;
+}
+
+// Splits the body in byte ranges that start right after a line break, so no value is ever cut in two.
+// Each range is counted first to know where its values land in the output, then all of them are parsed in place.
+// Every chunk only writes inside its own slice. A chunk that parses a different count than it has tokens holds a
+// malformed token, and the body is parsed again sequentially so the result is exactly the sequential one
+template <typename T>
+static std::size_t parseBodyParallel(const char*            begin,
+                                     const char*            end,
+                                     T*                     out,
+                                     std::size_t            capacity,
+                                     double                 nodata,
+                                     AscParser::Statistics& stats,
+                                     LoadProgress*          progress)
+{
+    // Below this size per chunk the thread startup costs more than the parsing
+    const std::size_t minChunkBytes = 1 << 20;
+    const std::size_t bodyBytes     = static_cast<std::size_t>(end - begin);
+    const std::size_t workerCount   = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t chunkCount    = std::min(workerCount, std::max<std::size_t>(1, bodyBytes / minChunkBytes));
+
+    if (chunkCount == 1)
+    {
+        return parseBodyRange(begin, end, out, 0, capacity, nodata, stats, progress);
+    }
+
+    std::vector<const char*> bounds(chunkCount + 1, end);
+    bounds[0] = begin;
+
+    for (std::size_t i = 1; i < chunkCount; ++i)
+    {
+        const char* target = std::max(bounds[i - 1], begin + bodyBytes * i / chunkCount);
+        const char* split  = std::find(target, end, '\n');
+        bounds[i]          = (split == end) ? end : split + 1;
+    }
+
+    std::vector<std::size_t>           tokenCounts(chunkCount);
+    std::vector<std::size_t>           parsedCounts(chunkCount);
+    std::vector<std::size_t>           firstIndices(chunkCount);
+    std::vector<AscParser::Statistics> chunkStats(chunkCount);
+
+    runOnThreads(chunkCount, [&](std::size_t i) { tokenCounts[i] = countTokens(bounds[i], bounds[i + 1]); });
+    throwIfCancelled(progress);
+
+    std::size_t runningIndex = 0;
+    for (std::size_t i = 0; i < chunkCount; ++i)
+    {
+        firstIndices[i] = runningIndex;
+        runningIndex += tokenCounts[i];
+    }
+
+    runOnThreads(chunkCount,
+                 [&](std::size_t i)
+                 {
+                     const std::size_t sliceEnd = std::min(capacity, firstIndices[i] + tokenCounts[i]);
+
+                     parsedCounts[i] = parseBodyRange(
+                         bounds[i], bounds[i + 1], out, firstIndices[i], sliceEnd, nodata, chunkStats[i], progress);
+                 });
+    throwIfCancelled(progress);
+
+    if (parsedCounts != tokenCounts)
+    {
+        return parseBodyRange(begin, end, out, 0, capacity, nodata, stats, progress);
+    }
+
+    for (const AscParser::Statistics& chunk : chunkStats)
+    {
+        stats.merge(chunk);
+    }
+
+    return runningIndex;
+}
+
+// Statistics are taken from the parsed double values, before any narrowing to the storage type
+template <typename T>
+static std::size_t parseBody(const char*            begin,
+                             const char*            end,
+                             AscParser::LoadMode    mode,
+                             std::vector<T>&        storage,
+                             std::size_t            expectedCount,
+                             double                 nodata,
+                             AscParser::Statistics& stats,
+                             LoadProgress*          progress)
+{
+    storage.resize(expectedCount);
+
+    const std::size_t count = (mode == AscParser::LoadMode::Parallel)
+                                  ? parseBodyParallel(begin, end, storage.data(), expectedCount, nodata, stats, progress)
+                                  : parseBodyRange(begin, end, storage.data(), 0, expectedCount, nodata, stats, progress);
+
+    // Checked on the calling thread, the workers only stop early
+    throwIfCancelled(progress);
+
+    return count;
+}
+
+AscParser::AscParser(const std::string& filepath) : AscParser(filepath, LoadOptions{})
+{
+}
+
+AscParser::AscParser(const std::string& filepath, const LoadOptions& options)
+{
+    loadFile(filepath, options);
+}
+
+void AscParser::loadFile(const std::string& filepath, const LoadOptions& options)
+{
+    m_precision = options.precision;
+
+    AscBinaryCache::SourceStamp stamp;
+    std::string                 cachePath;
+
+    const bool useCache = options.useBinaryCache && m_precision == Precision::Float &&
+                          AscBinaryCache::getSourceStamp(filepath, stamp);
+
+    if (useCache)
+    {
+        cachePath = AscBinaryCache::getCachePath(filepath, options.cacheDirectory);
+
+        AscBinaryCache::Contents cached;
+        if (AscBinaryCache::open(cachePath, stamp, m_cacheFile, cached))
+        {
+            m_header     = cached.header;
+            m_statistics = cached.statistics;
+            m_floatCells = cached.cells;
+
+            if (options.progress)
+            {
+                options.progress->bytesTotal.store(m_cacheFile.size());
+                options.progress->advance(m_cacheFile.size());
+            }
+
+            return;
+        }
+    }
+
+    const MappedFile file(filepath);
+
+    if (options.progress)
+    {
+        options.progress->bytesTotal.store(file.size());
+    }
+
+    const char*   cursor       = file.data();
+    const char*   end          = file.data() + file.size();
     const uint8_t header_lines = 6;
 
     for (int i = 0; i < header_lines; ++i)
     {
-        if (!std::getline(file, line))
+        if (cursor == end)
         {
             throw std::runtime_error("Error reading header from file: " + filepath);
         }
 
-        std::stringstream ss(line);
-        ss >> key;
-        std::string lowerKey = toLower(key);
+        const char* lineEnd = std::find(cursor, end, '\n');
+        const char* lineCur = cursor;
+        cursor              = (lineEnd == end) ? end : lineEnd + 1;
+
+        const std::string_view key   = nextToken(lineCur, lineEnd);
+        const std::string_view value = nextToken(lineCur, lineEnd);
 
-        if (lowerKey == HeaderKeys::NCOLS)
+        if (equalsIgnoreCase(key, HeaderKeys::NCOLS))
         {
-            ss >> m_header.ncols;
+            parseHeaderValue(value, m_header.ncols);
         }
-        else if (lowerKey == HeaderKeys::NROWS)
+        else if (equalsIgnoreCase(key, HeaderKeys::NROWS))
         {
-            ss >> m_header.nrows;
+            parseHeaderValue(value, m_header.nrows);
         }
-        else if (lowerKey == HeaderKeys::XLLCORNER)
+        else if (equalsIgnoreCase(key, HeaderKeys::XLLCORNER))
         {
-            ss >> m_header.xllcorner;
+            parseHeaderValue(value, m_header.xllcorner);
         }
-        else if (lowerKey == HeaderKeys::YLLCORNER)
+        else if (equalsIgnoreCase(key, HeaderKeys::YLLCORNER))
         {
-            ss >> m_header.yllcorner;
+            parseHeaderValue(value, m_header.yllcorner);
         }
-        else if (lowerKey == HeaderKeys::CELLSIZE)
+        else if (equalsIgnoreCase(key, HeaderKeys::CELLSIZE))
         {
-            ss >> m_header.cellsize;
+            parseHeaderValue(value, m_header.cellsize);
         }
-        else if (lowerKey == HeaderKeys::NODATA_VALUE)
+        else if (equalsIgnoreCase(key, HeaderKeys::NODATA_VALUE))
         {
-            ss >> m_header.nodata_value;
+            parseHeaderValue(value, m_header.nodata_value);
         }
         else
         {
-            throw std::runtime_error("Unknown header key: " + key);
+            throw std::runtime_error("Unknown header key: " + std::string(key));
         }
     }
 
@@ -84,59 +374,98 @@ void AscParser::loadFile(const std::string& filepath)
         throw std::runtime_error("Invalid header data: ncols or nrows is zero or negative.");
     }
 
-    m_data.reserve(m_header.ncols * m_header.nrows);
+    const std::size_t expectedCount = static_cast<std::size_t>(m_header.ncols) * static_cast<std::size_t>(m_header.nrows);
+    const double      nodata        = m_header.nodata_value;
+    LoadProgress*     progress      = options.progress;
 
-    double value;
-    while (file >> value)
+    if (progress)
     {
-        m_data.push_back(value);
+        progress->advance(static_cast<std::size_t>(cursor - file.data()));
     }
 
-    if (m_data.size() != static_cast<size_t>(m_header.ncols * m_header.nrows))
+    const std::size_t count =
+        (m_precision == Precision::Float)
+            ? parseBody(cursor, end, options.mode, m_floatData, expectedCount, nodata, m_statistics, progress)
+            : parseBody(cursor, end, options.mode, m_data, expectedCount, nodata, m_statistics, progress);
+
+    if (count != expectedCount)
     {
-        throw std::runtime_error("Data size mismatch. Expected " + std::to_string(m_header.ncols * m_header.nrows) +
-                                 " values, but found " + std::to_string(m_data.size()));
+        throw std::runtime_error("Data size mismatch. Expected " + std::to_string(expectedCount) +
+                                 " values, but found " + std::to_string(count));
     }
-}
 
-void AscParser::findMinMax()
-{
-    m_minValue = std::numeric_limits<double>::max();
-    m_maxValue = std::numeric_limits<double>::lowest();
+    m_floatCells = m_floatData.data();
 
-    for (const double value : m_data)
+    // A missing cache only costs the next load a parse, so failing to write one is not an error
+    if (useCache)
     {
-        if (value != m_header.nodata_value)
+        try
         {
-            if (value < m_minValue)
-            {
-                m_minValue = value;
-            }
-
-            if (value > m_maxValue)
-            {
-                m_maxValue = value;
-            }
+            AscBinaryCache::write(cachePath, stamp, m_header, m_statistics, m_floatCells, expectedCount);
+        } catch (const std::exception& e)
+        {
+            std::cerr << "AscParser - could not write binary cache " << cachePath << ": " << e.what() << std::endl;
         }
     }
 }
 
+bool AscParser::isLoadedFromCache() const
+{
+    return m_cacheFile.data() != nullptr;
+}
+
 const AscParser::Header& AscParser::getHeader() const
 {
     return m_header;
 }
 
-const std::vector<double>& AscParser::getData() const
+AscParser::Precision AscParser::getPrecision() const
+{
+    return m_precision;
+}
+
+std::size_t AscParser::getCellCount() const
+{
+    return static_cast<std::size_t>(m_header.ncols) * static_cast<std::size_t>(m_header.nrows);
+}
+
+const double* AscParser::getDoubleData() const
+{
+    return (m_precision == Precision::Double) ? m_data.data() : nullptr;
+}
+
+const float* AscParser::getFloatData() const
+{
+    return (m_precision == Precision::Float) ? m_floatCells : nullptr;
+}
+
+double AscParser::getValue(std::size_t index) const
+{
+    return (m_precision == Precision::Float) ? static_cast<double>(m_floatCells[index]) : m_data[index];
+}
+
+bool AscParser::isNoData(std::size_t index) const
+{
+    // Compare in storage precision so a float cell still matches the narrowed nodata value
+    if (m_precision == Precision::Float)
+    {
+        return m_floatCells[index] == static_cast<float>(m_header.nodata_value);
+    }
+
+    return m_data[index] == m_header.nodata_value;
+}
+
+const AscParser::Statistics& AscParser::getStatistics() const
 {
-    return m_data;
+    return m_statistics;
 }
 
 double AscParser::getMinValue() const
 {
-    return m_minValue;
+    return m_statistics.min;
 }
 
 double AscParser::getMaxValue() const
 {
-    return m_maxValue;
+    return m_statistics.max;
 }
\ No newline at end of file
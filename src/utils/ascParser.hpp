@@ -1,10 +1,16 @@
 #ifndef ASC_PARSER_HPP
 #define ASC_PARSER_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "loadProgress.hpp"
+#include "mappedFile.hpp"
+
 class AscParser
 {
 public:
@@ -28,21 +34,87 @@ public:
         double nodata_value = -9999.0;
     };
 
+    // Gathered while parsing, nodata cells are excluded from min, max and sum
+    struct Statistics
+    {
+        double      min         = std::numeric_limits<double>::max();
+        double      max         = std::numeric_limits<double>::lowest();
+        double      sum         = 0.0;
+        std::size_t validCount  = 0;
+        std::size_t nodataCount = 0;
+
+        double mean() const
+        {
+            return validCount > 0 ? sum / static_cast<double>(validCount) : 0.0;
+        }
+
+        void merge(const Statistics& other)
+        {
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+            sum += other.sum;
+            validCount += other.validCount;
+            nodataCount += other.nodataCount;
+        }
+    };
+
+    // Parallel splits the body in line aligned chunks parsed on one thread each
+    enum class LoadMode
+    {
+        Sequential,
+        Parallel
+    };
+
+    // Float halves the resident memory and is what the heatmap texture consumes directly
+    enum class Precision
+    {
+        Double,
+        Float
+    };
+
+    // The binary cache only applies to Float precision. Cached cells are memory mapped instead of parsed
+    struct LoadOptions
+    {
+        LoadMode    mode           = LoadMode::Sequential;
+        Precision   precision      = Precision::Double;
+        bool        useBinaryCache = false;
+        std::string cacheDirectory; // empty keeps the .ascb next to the source file
+
+        // Optional, must outlive the load. Cancelling it makes the constructor throw LoadCancelled
+        LoadProgress* progress = nullptr;
+    };
+
     AscParser(const std::string& filepath);
+    AscParser(const std::string& filepath, const LoadOptions& options);
+
+    const Header&     getHeader() const;
+    const Statistics& getStatistics() const;
+    double            getMinValue() const;
+    double            getMaxValue() const;
 
-    const Header&              getHeader() const;
-    const std::vector<double>& getData() const;
-    double                     getMinValue() const;
-    double                     getMaxValue() const;
+    // Cells are stored row major in the precision chosen at load time. Only the matching pointer is non null
+    Precision     getPrecision() const;
+    std::size_t   getCellCount() const;
+    const double* getDoubleData() const;
+    const float*  getFloatData() const;
+    bool          isLoadedFromCache() const;
+
+    // Precision independent access. Slower than the raw pointers so keep it out of per cell loops
+    double getValue(std::size_t index) const;
+    bool   isNoData(std::size_t index) const;
 
 private:
     Header              m_header;
+    Precision           m_precision = Precision::Double;
     std::vector<double> m_data;
-    double              m_minValue;
-    double              m_maxValue;
+    std::vector<float>  m_floatData;
+    Statistics          m_statistics;
+
+    // Float cells live either in m_floatData or in the mapped binary cache
+    const float* m_floatCells = nullptr;
+    MappedFile   m_cacheFile;
 
-    void loadFile(const std::string& filepath);
-    void findMinMax();
+    void loadFile(const std::string& filepath, const LoadOptions& options);
 };
 
 #endif
\ No newline at end of file
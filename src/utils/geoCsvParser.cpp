@@ -1,145 +1,224 @@
-#include <fstream>
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
 
 #include "geoCsvParser.hpp"
+#include "mappedFile.hpp"
+#include "runOnThreads.hpp"
 #include "wktParser.hpp"
 
-static std::string toLower(const std::string& str)
+// Columns looked up in the header, all of them but misc are required
+enum Column : std::size_t
 {
-    std::string lower_str = str;
+    COLUMN_ID,
+    COLUMN_NAME,
+    COLUMN_TYPE,
+    COLUMN_LIFE,
+    COLUMN_GEOM,
+    COLUMN_MISC,
+    COLUMN_COUNT
+};
 
-    for (char& c : lower_str)
-    {
-        c = std::tolower(c);
-    }
+static const char* const COLUMN_NAMES[COLUMN_COUNT] = {"id", "name", "type", "life", "geom", "misc"};
 
-    return lower_str;
-}
+// Field index of each column in a record. A missing optional column maps past the end of any record
+using Columns = std::array<std::size_t, COLUMN_COUNT>;
+
+// Progress is published (and cancellation polled) once per PROGRESS_STRIDE bytes of records read
+static constexpr std::size_t PROGRESS_STRIDE = 1 << 20;
 
-// Trimming reference at https://stackoverflow.com/questions/216823/how-can-i-trim-a-stdstring
-static void ltrim(std::string& s)
+static bool isSpace(char c)
 {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char c) { return !std::isspace(c); }));
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
 }
 
-static void rtrim(std::string& s)
+static std::string_view trim(std::string_view s)
 {
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char c) { return !std::isspace(c); }).base(), s.end());
+    while (!s.empty() && isSpace(s.front()))
+    {
+        s.remove_prefix(1);
+    }
+
+    while (!s.empty() && isSpace(s.back()))
+    {
+        s.remove_suffix(1);
+    }
+
+    return s;
 }
 
-static void trim(std::string& s)
+static bool equalsIgnoreCase(std::string_view a, std::string_view b)
 {
-    ltrim(s);
-    rtrim(s);
+    return a.size() == b.size() && std::equal(a.begin(),
+                                              a.end(),
+                                              b.begin(),
+                                              [](char x, char y)
+                                              {
+                                                  return std::tolower(static_cast<unsigned char>(x)) ==
+                                                         std::tolower(static_cast<unsigned char>(y));
+                                              });
 }
 
-// Remove surrounding quotes
-std::string unquote(const std::string& in)
+// Returns the record starting at cursor and moves cursor past its line break. A record ends at the first newline
+// outside quotes, so quoted fields may span lines. outLineBreaks is the number of newlines consumed
+static std::string_view nextRecord(const char*& cursor, const char* end, std::size_t& outLineBreaks)
 {
-    if (in.size() >= 2 && in.front() == '"' && in.back() == '"')
+    const char* start     = cursor;
+    const char* recordEnd = end;
+    std::size_t quotes    = 0;
+    outLineBreaks         = 0;
+
+    while (cursor < end)
     {
-        std::string out;
-        out.reserve(in.size() - 2);
+        const void* found   = std::memchr(cursor, '\n', static_cast<std::size_t>(end - cursor));
+        const char* lineEnd = found ? static_cast<const char*>(found) : end;
+        quotes += static_cast<std::size_t>(std::count(cursor, lineEnd, '"'));
+        cursor = found ? lineEnd + 1 : end;
 
-        for (size_t i = 1; i + 1 < in.size(); ++i)
+        if (found)
         {
-            if (in[i] == '"' && i + 1 < in.size() - 1 && in[i + 1] == '"')
-            {
-                out.push_back('"');
-                ++i; // consume escaped quote
-            }
-            else
-            {
-                out.push_back(in[i]);
-            }
+            ++outLineBreaks;
+        }
+
+        if (quotes % 2 == 0)
+        {
+            recordEnd = lineEnd;
+            break;
         }
+    }
 
-        return out;
+    if (recordEnd > start && recordEnd[-1] == '\r')
+    {
+        --recordEnd;
     }
 
-    return in;
+    return std::string_view(start, static_cast<std::size_t>(recordEnd - start));
 }
 
-std::vector<std::string> splitCSVLine(const std::string& line)
+// Splits a record on ';' outside quotes. Fields are raw views into the record, quotes included.
+// fields is reused between records so it stops allocating once it has grown to the column count
+static void splitFields(std::string_view record, std::vector<std::string_view>& fields)
 {
-    std::vector<std::string> fields;
-    std::string              curr;
-    bool                     inQuotes = false;
+    fields.clear();
+
+    std::size_t fieldStart = 0;
+    bool        inQuotes   = false;
 
-    for (size_t i = 0; i < line.size(); ++i)
+    for (std::size_t i = 0; i < record.size(); ++i)
     {
-        char c = line[i];
+        const char c = record[i];
 
-        if (inQuotes)
+        if (c == '"')
         {
-            if (c == '"')
-            {
-                if (i + 1 < line.size() && line[i + 1] == '"')
-                {
-                    curr.push_back('"');
-                    ++i;
-                } // escaped quote
-                else
-                {
-                    inQuotes = false;
-                }
-            }
-            else
-            {
-                curr.push_back(c);
-            }
+            inQuotes = !inQuotes; // an escaped quote toggles twice
         }
-        else
+        else if (c == ';' && !inQuotes)
         {
-            if (c == '"')
-                inQuotes = true;
-            else if (c == ';')
-            {
-                fields.emplace_back(std::move(curr));
-                curr.clear();
-            }
-            else
-            {
-                curr.push_back(c);
-            }
+            fields.push_back(record.substr(fieldStart, i - fieldStart));
+            fieldStart = i + 1;
         }
     }
 
-    fields.emplace_back(std::move(curr));
+    fields.push_back(record.substr(fieldStart));
+}
+
+// Removes the quoting of a raw field. Plain and simply quoted fields are returned as views, only a field with
+// escaped ("") or stray quotes is rewritten, into scratch, which the result then refers to
+static std::string_view decodeField(std::string_view raw, std::string& scratch)
+{
+    if (raw.find('"') == std::string_view::npos)
+    {
+        return raw;
+    }
+
+    if (raw.size() >= 2 && raw.front() == '"' && raw.back() == '"')
+    {
+        const std::string_view inner = raw.substr(1, raw.size() - 2);
+
+        if (inner.find('"') == std::string_view::npos)
+        {
+            return inner;
+        }
+    }
+
+    scratch.clear();
+    bool inQuotes = false;
+
+    for (std::size_t i = 0; i < raw.size(); ++i)
+    {
+        const char c = raw[i];
+
+        if (c != '"')
+        {
+            scratch.push_back(c);
+        }
+        else if (inQuotes && i + 1 < raw.size() && raw[i + 1] == '"')
+        {
+            scratch.push_back('"');
+            ++i; // escaped quote
+        }
+        else
+        {
+            inQuotes = !inQuotes;
+        }
+    }
 
-    return fields;
+    return scratch;
 }
 
-GeoCsvParser::EntityType parseEntityType(std::string v)
+// Like std::stoul/std::stod but without the copy: surrounding whitespace and a leading '+' are accepted,
+// anything else left over makes it fail
+template <typename T>
+static bool parseNumber(std::string_view text, T& out)
 {
-    v = toLower(v);
+    text = trim(text);
 
-    if (v == "maximum")
+    if (!text.empty() && text.front() == '+')
+    {
+        text.remove_prefix(1);
+    }
+
+    const char* last     = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), last, out);
+
+    return !text.empty() && ec == std::errc() && ptr == last;
+}
+
+static GeoCsvParser::EntityType parseEntityType(std::string_view v)
+{
+    if (equalsIgnoreCase(v, "maximum"))
     {
         return GeoCsvParser::EntityType::Maximum;
     }
 
-    if (v == "minimum")
+    if (equalsIgnoreCase(v, "minimum"))
     {
         return GeoCsvParser::EntityType::Minimum;
     }
 
-    if (v == "saddle")
+    if (equalsIgnoreCase(v, "saddle"))
     {
         return GeoCsvParser::EntityType::Saddle;
     }
 
-    if (v == "line-ascending")
+    if (equalsIgnoreCase(v, "line-ascending"))
     {
         return GeoCsvParser::EntityType::LineAscending;
     }
 
-    if (v == "line-descending")
+    if (equalsIgnoreCase(v, "line-descending"))
     {
         return GeoCsvParser::EntityType::LineDescending;
     }
 
-    if (v == "area")
+    if (equalsIgnoreCase(v, "area"))
     {
         return GeoCsvParser::EntityType::Area;
     }
@@ -147,138 +226,299 @@ GeoCsvParser::EntityType parseEntityType(std::string v)
     return GeoCsvParser::EntityType::Unknown;
 }
 
-GeoCsvParser::GeoCsvParser(const std::string& filepath)
+// Parses the records in [cursor, end) and appends them to out, their coordinates to store. firstLineIndex is the
+// line cursor is on, only used for error messages. Throws on the first malformed record
+static void parseRecords(const char*                        cursor,
+                         const char*                        end,
+                         uint64_t                           firstLineIndex,
+                         const Columns&                     columns,
+                         std::vector<GeoCsvParser::Entity>& out,
+                         GeoCsvParser::GeometryStore&       store,
+                         LoadProgress*                      progress)
 {
-    loadFile(filepath);
-    findLifeMinMax();
+    const char*                   reportedUpTo     = cursor;
+    uint64_t                      currentLineIndex = firstLineIndex - 1;
+    std::size_t                   lineBreaks       = 0;
+    std::vector<std::string_view> fields;
+    std::string                   scratch;
+    std::string                   wktScratch;
+
+    while (cursor < end)
+    {
+        const uint64_t         recordLineIndex = currentLineIndex + 1;
+        const std::string_view record          = nextRecord(cursor, end, lineBreaks);
+        currentLineIndex += std::max<std::size_t>(lineBreaks, 1);
+
+        if (progress && static_cast<std::size_t>(cursor - reportedUpTo) >= PROGRESS_STRIDE)
+        {
+            progress->advance(static_cast<std::size_t>(cursor - reportedUpTo));
+            reportedUpTo = cursor;
+
+            if (progress->isCancelled())
+            {
+                throw LoadCancelled();
+            }
+        }
+
+        if (record.empty())
+        {
+            continue;
+        }
+
+        splitFields(record, fields);
+
+        for (std::size_t c = 0; c < COLUMN_MISC; ++c)
+        {
+            if (columns[c] >= fields.size())
+            {
+                throw std::runtime_error("GeoCsvParser: line " + std::to_string(recordLineIndex) +
+                                         " has fewer columns than header index for '" + COLUMN_NAMES[c] + "'");
+            }
+        }
+
+        // Decoded fields may point into scratch, so each one is consumed before the next is decoded
+        const std::string_view wkt = decodeField(fields[columns[COLUMN_GEOM]], wktScratch);
+        if (wkt.empty())
+        {
+            throw std::runtime_error("GeoCsvParser: empty geometry at line " + std::to_string(recordLineIndex));
+        }
+
+        GeoCsvParser::Entity entity;
+
+        const std::string_view idStr = decodeField(fields[columns[COLUMN_ID]], scratch);
+        if (!parseNumber(idStr, entity.id))
+        {
+            throw std::runtime_error("GeoCsvParser: invalid id at line " + std::to_string(recordLineIndex) + ": '" +
+                                     std::string(idStr) + "'");
+        }
+
+        entity.name = decodeField(fields[columns[COLUMN_NAME]], scratch);
+        entity.type = parseEntityType(decodeField(fields[columns[COLUMN_TYPE]], scratch));
+
+        const std::string_view lifeStr = decodeField(fields[columns[COLUMN_LIFE]], scratch);
+        if (!parseNumber(lifeStr, entity.life))
+        {
+            throw std::runtime_error("GeoCsvParser: invalid life at line " + std::to_string(recordLineIndex) + ": '" +
+                                     std::string(lifeStr) + "'");
+        }
+
+        if (columns[COLUMN_MISC] < fields.size())
+        {
+            entity.misc = decodeField(fields[columns[COLUMN_MISC]], scratch);
+        }
+
+        entity.geom = WktParser(wkt).parse(store);
+        out.push_back(std::move(entity));
+    }
+
+    if (progress)
+    {
+        progress->advance(static_cast<std::size_t>(end - reportedUpTo));
+    }
 }
 
-void GeoCsvParser::loadFile(const std::string& filepath)
+// Splits [begin, end) in chunks that start on a record boundary and parses them on one thread each.
+// A newline ends a record only if the number of quotes before it is even, so the quotes of every slice are
+// counted first and the parity at each tentative split tells whether a newline there is inside a quoted field.
+// Chunks are merged in file order and if several fail, the error of the first one is the one thrown, so results
+// and messages are the same as a sequential parse
+static void parseRecordsParallel(const char*                        begin,
+                                 const char*                        end,
+                                 uint64_t                           firstLineIndex,
+                                 const Columns&                     columns,
+                                 std::vector<GeoCsvParser::Entity>& out,
+                                 GeoCsvParser::GeometryStore&       store,
+                                 LoadProgress*                      progress)
 {
-    std::ifstream in(filepath);
-    if (!in.is_open())
+    // Below this size per chunk the thread startup costs more than the parsing
+    const std::size_t minChunkBytes = 1 << 20;
+    const std::size_t bodyBytes     = static_cast<std::size_t>(end - begin);
+    const std::size_t workerCount   = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t chunkCount    = std::min(workerCount, std::max<std::size_t>(1, bodyBytes / minChunkBytes));
+
+    if (chunkCount == 1)
     {
-        throw std::runtime_error("GeoCsvParser: cannot open file: " + filepath);
+        parseRecords(begin, end, firstLineIndex, columns, out, store, progress);
+
+        return;
     }
 
-    std::string headerLine;
-    if (!std::getline(in, headerLine))
+    std::vector<const char*> slices(chunkCount + 1, end);
+    std::vector<std::size_t> sliceQuotes(chunkCount);
+
+    for (std::size_t i = 0; i < chunkCount; ++i)
     {
-        throw std::runtime_error("GeoCsvParser: empty file: " + filepath);
+        slices[i] = begin + bodyBytes * i / chunkCount;
     }
 
-    auto header = splitCSVLine(headerLine);
-    for (auto& f : header)
+    runOnThreads(chunkCount,
+                 [&](std::size_t i)
+                 { sliceQuotes[i] = static_cast<std::size_t>(std::count(slices[i], slices[i + 1], '"')); });
+
+    // From each slice start, walk to the first newline outside quotes. A record longer than a slice leaves an
+    // empty chunk behind, which is harmless
+    std::vector<const char*> bounds(chunkCount + 1, end);
+    bounds[0]                = begin;
+    std::size_t quotesBefore = 0;
+
+    for (std::size_t i = 1; i < chunkCount; ++i)
     {
-        trim(f);
-        f = toLower(f);
+        quotesBefore += sliceQuotes[i - 1];
+
+        const char* cursor   = slices[i];
+        bool        inQuotes = quotesBefore % 2 != 0;
+
+        while (cursor < end && (*cursor != '\n' || inQuotes))
+        {
+            inQuotes ^= (*cursor == '"');
+            ++cursor;
+        }
+
+        bounds[i] = std::max(bounds[i - 1], (cursor == end) ? end : cursor + 1);
     }
 
-    std::unordered_map<std::string, size_t> headerMap;
-    for (size_t i = 0; i < header.size(); ++i)
+    std::vector<uint64_t> lineBreaks(chunkCount);
+    runOnThreads(chunkCount,
+                 [&](std::size_t i)
+                 { lineBreaks[i] = static_cast<uint64_t>(std::count(bounds[i], bounds[i + 1], '\n')); });
+
+    std::vector<uint64_t> firstLines(chunkCount);
+    firstLines[0] = firstLineIndex;
+
+    for (std::size_t i = 1; i < chunkCount; ++i)
     {
-        trim(header[i]);
-        header[i]            = toLower(header[i]);
-        headerMap[header[i]] = i;
+        firstLines[i] = firstLines[i - 1] + lineBreaks[i - 1];
     }
 
-    const char* requiredColumns[] = {"id", "name", "type", "life", "geom"};
-    for (auto column : requiredColumns)
+    std::vector<std::vector<GeoCsvParser::Entity>> chunkEntities(chunkCount);
+    std::vector<GeoCsvParser::GeometryStore>       chunkStores(chunkCount);
+    std::vector<std::exception_ptr>                chunkErrors(chunkCount);
+
+    runOnThreads(chunkCount,
+                 [&](std::size_t i)
+                 {
+                     try
+                     {
+                         parseRecords(bounds[i],
+                                      bounds[i + 1],
+                                      firstLines[i],
+                                      columns,
+                                      chunkEntities[i],
+                                      chunkStores[i],
+                                      progress);
+                     } catch (...)
+                     {
+                         chunkErrors[i] = std::current_exception();
+                     }
+                 });
+
+    std::size_t entityCount = out.size();
+    std::size_t pointCount  = store.points.size();
+    std::size_t ringCount   = store.ringStarts.size();
+    std::size_t partCount   = store.partStarts.size();
+
+    for (std::size_t i = 0; i < chunkCount; ++i)
     {
-        if (!headerMap.count(column))
+        if (chunkErrors[i])
         {
-            throw std::runtime_error(std::string("GeoCsvParser: missing header '") + column + "'");
+            std::rethrow_exception(chunkErrors[i]);
         }
-    }
 
-    std::string line;
-    uint64_t    currentLineIndex = 1; // already consumed header
-    m_entities.clear();
+        entityCount += chunkEntities[i].size();
+        pointCount += chunkStores[i].points.size();
+        ringCount += chunkStores[i].getRingCount();
+        partCount += chunkStores[i].getPartCount();
+    }
 
-    while (std::getline(in, line))
+    out.reserve(entityCount);
+    store.points.reserve(pointCount);
+    store.ringStarts.reserve(ringCount);
+    store.partStarts.reserve(partCount);
+    for (std::size_t i = 0; i < chunkCount; ++i)
     {
-        ++currentLineIndex;
-        if (line.empty())
+        // Chunk geometry is indexed from zero, shift it to where the chunk store lands in the merged one
+        const uint32_t firstPart = store.append(chunkStores[i]);
+
+        for (auto& entity : chunkEntities[i])
         {
-            continue;
+            entity.geom.firstPart += firstPart;
+            out.push_back(std::move(entity));
         }
 
-        auto cols = splitCSVLine(line);
+        chunkStores[i] = GeoCsvParser::GeometryStore();
+    }
+}
 
-        // Accessors: required/optional by header name
-        auto get = [&](const std::string& k, bool required) -> std::string
-        {
-            auto it = headerMap.find(k);
-            if (it == headerMap.end())
-            {
-                if (required)
-                    throw std::runtime_error("GeoCsvParser: missing header '" + k + "'");
-                return {};
-            }
-            const size_t idx = it->second;
-            if (idx >= cols.size())
-            {
-                if (required)
-                {
-                    throw std::runtime_error("GeoCsvParser: line " + std::to_string(currentLineIndex) +
-                                             " has fewer columns than header index for '" + k + "'");
-                }
-                return {};
-            }
-            return cols[idx];
-        };
+GeoCsvParser::GeoCsvParser(const std::string& filepath) : GeoCsvParser(filepath, LoadOptions{})
+{
+}
 
-        // TODO: Use the required columns from above instead of hardcoding them again
-        std::string idStr   = get("id", true);
-        std::string name    = unquote(get("name", true));
-        std::string typeStr = get("type", true);
-        std::string lifeStr = get("life", true);
-        std::string misc    = unquote(get("misc", false));
-        std::string wkt     = unquote(get("geom", true));
+GeoCsvParser::GeoCsvParser(const std::string& filepath, const LoadOptions& options)
+{
+    loadFile(filepath, options);
+    findLifeMinMax();
+}
 
-        if (wkt.empty())
-        {
-            throw std::runtime_error("GeoCsvParser: empty geometry at line " + std::to_string(currentLineIndex));
-        }
+void GeoCsvParser::loadFile(const std::string& filepath, const LoadOptions& options)
+{
+    const MappedFile file(filepath);
+    const char*      cursor   = file.data();
+    const char*      end      = file.data() + file.size();
+    LoadProgress*    progress = options.progress;
 
-        uint32_t id = 0;
-        try
-        {
-            size_t        index = 0;
-            unsigned long val   = std::stoul(idStr, &index);
+    if (cursor == end)
+    {
+        throw std::runtime_error("GeoCsvParser: empty file: " + filepath);
+    }
 
-            if (index != idStr.size())
-            {
-                throw std::runtime_error("trailing chars");
-            }
+    if (progress)
+    {
+        progress->bytesTotal.store(file.size());
+    }
 
-            id = static_cast<uint32_t>(val);
-        } catch (...)
-        {
-            throw std::runtime_error(
-                "GeoCsvParser: invalid id at line " + std::to_string(currentLineIndex) + ": '" + idStr + "'");
-        }
+    std::size_t                   lineBreaks = 0;
+    std::vector<std::string_view> header;
+    splitFields(nextRecord(cursor, end, lineBreaks), header);
 
-        auto   entityType = parseEntityType(typeStr);
-        double life       = 0.0;
+    // Header names are unquoted like any data field, scratch copies keep the escaped ones alive
+    std::vector<std::string> headerScratch(header.size());
+    for (std::size_t i = 0; i < header.size(); ++i)
+    {
+        header[i] = trim(decodeField(header[i], headerScratch[i]));
+    }
 
-        try
-        {
-            size_t index = 0;
-            life         = std::stod(lifeStr, &index);
+    // Header lookup is done once, records are then indexed directly
+    Columns columns;
+    for (std::size_t c = 0; c < COLUMN_COUNT; ++c)
+    {
+        const auto it = std::find_if(header.begin(),
+                                     header.end(),
+                                     [c](std::string_view f) { return equalsIgnoreCase(f, COLUMN_NAMES[c]); });
 
-            if (index != lifeStr.size())
-            {
-                throw std::runtime_error("trailing chars");
-            }
-        } catch (...)
+        if (it == header.end() && c < COLUMN_MISC)
         {
-            throw std::runtime_error(
-                "GeoCsvParser: invalid life at line " + std::to_string(currentLineIndex) + ": '" + lifeStr + "'");
+            throw std::runtime_error(std::string("GeoCsvParser: missing header '") + COLUMN_NAMES[c] + "'");
         }
 
-        Geometry geom = WktParser(wkt).parse();
-        m_entities.push_back(Entity{id, std::move(name), entityType, life, std::move(misc), std::move(geom)});
+        columns[c] = static_cast<std::size_t>(it - header.begin());
+    }
+
+    if (progress)
+    {
+        progress->advance(static_cast<std::size_t>(cursor - file.data()));
+    }
+
+    const uint64_t firstLineIndex = lineBreaks + 1; // line numbers start at 1 with the header
+    m_entities.clear();
+    m_geometryStore = GeometryStore();
+
+    if (options.mode == LoadMode::Parallel)
+    {
+        parseRecordsParallel(cursor, end, firstLineIndex, columns, m_entities, m_geometryStore, progress);
+    }
+    else
+    {
+        parseRecords(cursor, end, firstLineIndex, columns, m_entities, m_geometryStore, progress);
     }
 }
 
@@ -306,6 +546,78 @@ const std::vector<GeoCsvParser::Entity>& GeoCsvParser::getEntities() const
     return m_entities;
 }
 
+const GeoCsvParser::GeometryStore& GeoCsvParser::getGeometryStore() const
+{
+    return m_geometryStore;
+}
+
+GeoCsvParser::LineString GeoCsvParser::RingRange::operator[](std::size_t i) const
+{
+    return LineString{store->getRing(first + static_cast<uint32_t>(i))};
+}
+
+GeoCsvParser::Polygon GeoCsvParser::PolygonRange::operator[](std::size_t i) const
+{
+    const uint32_t part = first + static_cast<uint32_t>(i);
+
+    return Polygon{RingRange{store, store->partStarts[part], store->partStarts[part + 1] - store->partStarts[part]}};
+}
+
+GeoCsvParser::PointSpan GeoCsvParser::GeometryStore::getRing(uint32_t ring) const
+{
+    return PointSpan{points.data() + ringStarts[ring], ringStarts[ring + 1] - ringStarts[ring]};
+}
+
+GeoCsvParser::RingRange GeoCsvParser::GeometryStore::getLines(const Geometry& geometry) const
+{
+    if (geometry.type != GeometryType::LineString && geometry.type != GeometryType::MultiLineString)
+    {
+        return RingRange{this, 0, 0};
+    }
+
+    // One ring per part, so the lines are the rings spanned by the parts
+    const uint32_t firstRing = partStarts[geometry.firstPart];
+    const uint32_t endRing   = partStarts[geometry.firstPart + geometry.partCount];
+
+    return RingRange{this, firstRing, endRing - firstRing};
+}
+
+GeoCsvParser::PolygonRange GeoCsvParser::GeometryStore::getPolygons(const Geometry& geometry) const
+{
+    if (geometry.type != GeometryType::Polygon && geometry.type != GeometryType::MultiPolygon)
+    {
+        return PolygonRange{this, 0, 0};
+    }
+
+    return PolygonRange{this, geometry.firstPart, geometry.partCount};
+}
+
+uint32_t GeoCsvParser::GeometryStore::append(const GeometryStore& other)
+{
+    const uint32_t pointOffset = static_cast<uint32_t>(points.size());
+    const uint32_t ringOffset  = getRingCount();
+    const uint32_t partOffset  = getPartCount();
+
+    if (points.size() + other.points.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::runtime_error("GeoCsvParser: too many points for the geometry store");
+    }
+
+    points.insert(points.end(), other.points.begin(), other.points.end());
+
+    for (std::size_t r = 1; r < other.ringStarts.size(); ++r)
+    {
+        ringStarts.push_back(other.ringStarts[r] + pointOffset);
+    }
+
+    for (std::size_t p = 1; p < other.partStarts.size(); ++p)
+    {
+        partStarts.push_back(other.partStarts[p] + ringOffset);
+    }
+
+    return partOffset;
+}
+
 double GeoCsvParser::getMinLife() const
 {
     return m_minLife;
@@ -1,9 +1,13 @@
 #ifndef GEO_CSV_PARSER_HPP
 #define GEO_CSV_PARSER_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "loadProgress.hpp"
+
 class GeoCsvParser
 {
 public:
@@ -23,22 +27,111 @@ public:
         Unknown
     };
 
+    struct GeometryStore;
+
+    // Contiguous run of points inside a GeometryStore
+    struct PointSpan
+    {
+        const Point* first = nullptr;
+        std::size_t  count = 0;
+
+        const Point* begin() const { return first; }
+        const Point* end() const { return first + count; }
+        std::size_t  size() const { return count; }
+        bool         empty() const { return count == 0; }
+        const Point& operator[](std::size_t i) const { return first[i]; }
+    };
+
+    // Views with the shape of the former nested vectors, so callers still read line.points and polygon.rings
     struct LineString
     {
-        std::vector<Point> points;
+        PointSpan points;
+    };
+
+    // Walks a range by index, the view is built on dereference
+    template <typename Range>
+    class IndexIterator
+    {
+    public:
+        IndexIterator(const Range* range, std::size_t index) : m_range(range), m_index(index) {}
+
+        auto operator*() const { return (*m_range)[m_index]; }
+        bool operator==(const IndexIterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const IndexIterator& other) const { return m_index != other.m_index; }
+
+        IndexIterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+    private:
+        const Range* m_range;
+        std::size_t  m_index;
+    };
+
+    // Consecutive rings of the store, each seen as a LineString
+    struct RingRange
+    {
+        const GeometryStore* store = nullptr;
+        uint32_t             first = 0;
+        uint32_t             count = 0;
+
+        LineString               operator[](std::size_t i) const;
+        std::size_t              size() const { return count; }
+        bool                     empty() const { return count == 0; }
+        IndexIterator<RingRange> begin() const { return {this, 0}; }
+        IndexIterator<RingRange> end() const { return {this, count}; }
     };
 
     struct Polygon
     {
-        std::vector<LineString> rings;
+        RingRange rings;
     }; // ring[0] -> outer, 1.. -> holes
 
+    // Consecutive parts of the store, each seen as a Polygon
+    struct PolygonRange
+    {
+        const GeometryStore* store = nullptr;
+        uint32_t             first = 0;
+        uint32_t             count = 0;
+
+        Polygon                     operator[](std::size_t i) const;
+        std::size_t                 size() const { return count; }
+        bool                        empty() const { return count == 0; }
+        IndexIterator<PolygonRange> begin() const { return {this, 0}; }
+        IndexIterator<PolygonRange> end() const { return {this, count}; }
+    };
+
+    // Refers to its coordinates in the parser's GeometryStore by part range. A line is a part with a single ring,
+    // a polygon a part with its outer ring followed by the holes
     struct Geometry
     {
-        GeometryType            type = GeometryType::Unknown;
-        Point                   point{};  // used if (type == Point)
-        std::vector<LineString> lines;    // LINESTRING -> (size = 1); MULTILINESTRING -> (size >= 1)
-        std::vector<Polygon>    polygons; // POLYGON -> (size = 1); MULTIPOLYGON -> (size >= 1)
+        GeometryType type = GeometryType::Unknown;
+        Point        point{};       // used if (type == Point)
+        uint32_t     firstPart = 0; // LINESTRING -> 1 part; MULTILINESTRING -> >= 1 parts
+        uint32_t     partCount = 0; // POLYGON -> 1 part; MULTIPOLYGON -> >= 1 parts
+    };
+
+    // Every coordinate of a file in one array, so there is no allocation per line or ring and walking a geometry
+    // stays in contiguous memory. Rings are ranges of points and parts are ranges of rings
+    struct GeometryStore
+    {
+        std::vector<Point>    points;
+        std::vector<uint32_t> ringStarts{0}; // ring r is points [ringStarts[r], ringStarts[r + 1])
+        std::vector<uint32_t> partStarts{0}; // part p is rings [partStarts[p], partStarts[p + 1])
+
+        uint32_t getRingCount() const { return static_cast<uint32_t>(ringStarts.size() - 1); }
+        uint32_t getPartCount() const { return static_cast<uint32_t>(partStarts.size() - 1); }
+
+        PointSpan getRing(uint32_t ring) const;
+
+        // Lines of a LINESTRING/MULTILINESTRING (empty for polygons, whose rings come from getPolygons)
+        RingRange    getLines(const Geometry& geometry) const;
+        PolygonRange getPolygons(const Geometry& geometry) const;
+
+        // Appends the contents of other and returns the part index its parts now start at
+        uint32_t append(const GeometryStore& other);
     };
 
     enum class EntityType
@@ -62,18 +155,36 @@ public:
         Geometry    geom;
     };
 
+    // Parallel splits the records in chunks parsed on one thread each. Entities keep the file order either way
+    enum class LoadMode
+    {
+        Sequential,
+        Parallel
+    };
+
+    struct LoadOptions
+    {
+        LoadMode mode = LoadMode::Sequential;
+
+        // Optional, must outlive the load. Cancelling it makes the constructor throw LoadCancelled
+        LoadProgress* progress = nullptr;
+    };
+
     GeoCsvParser(const std::string& filepath);
+    GeoCsvParser(const std::string& filepath, const LoadOptions& options);
 
     const std::vector<Entity>& getEntities() const;
+    const GeometryStore&       getGeometryStore() const;
     double                     getMinLife() const;
     double                     getMaxLife() const;
 
 private:
     std::vector<Entity> m_entities;
+    GeometryStore       m_geometryStore;
     double              m_minLife = 0.0;
     double              m_maxLife = 0.0;
 
-    void loadFile(const std::string& filepath);
+    void loadFile(const std::string& filepath, const LoadOptions& options);
     void findLifeMinMax();
 };
 
@@ -0,0 +1,55 @@
+#ifndef LOAD_PROGRESS_HPP
+#define LOAD_PROGRESS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+// Shared between a loader running on a worker thread and the UI watching it.
+// The loader reports processed bytes and polls for cancellation, the UI reads the fraction and may cancel
+struct LoadProgress
+{
+    std::atomic<std::size_t> bytesProcessed{0};
+    std::atomic<std::size_t> bytesTotal{0};
+    std::atomic<bool>        cancelRequested{false};
+
+    void reset()
+    {
+        bytesProcessed.store(0);
+        bytesTotal.store(0);
+        cancelRequested.store(false);
+    }
+
+    void advance(std::size_t bytes)
+    {
+        bytesProcessed.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void cancel()
+    {
+        cancelRequested.store(true);
+    }
+
+    bool isCancelled() const
+    {
+        return cancelRequested.load(std::memory_order_relaxed);
+    }
+
+    float getFraction() const
+    {
+        const std::size_t total = bytesTotal.load(std::memory_order_relaxed);
+        const std::size_t done  = bytesProcessed.load(std::memory_order_relaxed);
+
+        return total > 0 ? static_cast<float>(std::min(done, total)) / static_cast<float>(total) : 0.0f;
+    }
+};
+
+// Thrown by a loader that stopped early because cancellation was requested
+class LoadCancelled : public std::runtime_error
+{
+public:
+    LoadCancelled() : std::runtime_error("Load cancelled") {}
+};
+
+#endif
@@ -0,0 +1,191 @@
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "mappedFile.hpp"
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filepath)
+{
+    HANDLE file = CreateFileA(filepath.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Could not open file: " + filepath);
+    }
+
+    m_fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        release();
+        throw std::runtime_error("Could not read file size: " + filepath);
+    }
+
+    m_size = static_cast<std::size_t>(fileSize.QuadPart);
+
+    // Mapping an empty file is an error on Windows. Keep an empty view instead
+    if (m_size == 0)
+    {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        release();
+        throw std::runtime_error("Could not map file: " + filepath);
+    }
+
+    m_mappingHandle = mapping;
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        release();
+        throw std::runtime_error("Could not map file: " + filepath);
+    }
+
+    m_data = static_cast<const char*>(view);
+}
+
+void MappedFile::release()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mappingHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+
+    if (m_fileHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    }
+
+    m_data          = nullptr;
+    m_size          = 0;
+    m_mappingHandle = nullptr;
+    m_fileHandle    = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filepath)
+{
+    const int fd = ::open(filepath.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Could not open file: " + filepath);
+    }
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("Could not read file size: " + filepath);
+    }
+
+    m_size = static_cast<std::size_t>(fileStat.st_size);
+
+    // mmap() rejects zero length mappings. Keep an empty view instead
+    if (m_size == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference to the file so the descriptor is not needed anymore
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        m_size = 0;
+        throw std::runtime_error("Could not map file: " + filepath);
+    }
+
+    m_data = static_cast<const char*>(mapping);
+}
+
+void MappedFile::release()
+{
+    if (m_data)
+    {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+
+#ifdef _WIN32
+        std::swap(m_fileHandle, other.m_fileHandle);
+        std::swap(m_mappingHandle, other.m_mappingHandle);
+#endif
+    }
+
+    return *this;
+}
+
+const char* MappedFile::data() const
+{
+    return m_data;
+}
+
+std::size_t MappedFile::size() const
+{
+    return m_size;
+}
+
+std::string_view MappedFile::view() const
+{
+    return std::string_view(m_data, m_size);
+}
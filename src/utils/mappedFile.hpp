@@ -0,0 +1,37 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read only memory mapping of a whole file. The mapping lives as long as the object (move only)
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const std::string& filepath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const char*      data() const;
+    std::size_t      size() const;
+    std::string_view view() const;
+
+private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+
+#ifdef _WIN32
+    void* m_fileHandle    = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+
+    void release();
+};
+
+#endif
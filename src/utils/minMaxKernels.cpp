@@ -0,0 +1,349 @@
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+#include "minMaxKernels.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MIN_MAX_KERNELS_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts AVX2 intrinsics anywhere, GCC and Clang only inside functions compiled for that target
+#if defined(__GNUC__) || defined(__clang__)
+#define MIN_MAX_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MIN_MAX_TARGET_AVX2
+#endif
+
+namespace
+{
+const float POSITIVE_INFINITY = std::numeric_limits<float>::infinity();
+const float NEGATIVE_INFINITY = -std::numeric_limits<float>::infinity();
+
+// Same comparisons as the loops the kernels replace. Also used for the tails of the vector paths
+template <typename T>
+std::size_t maskedMinMaxScalar(const T* data, std::size_t count, T nodata, float& outMin, float& outMax)
+{
+    std::size_t validCount = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const T value = data[i];
+        if (value == nodata)
+        {
+            continue;
+        }
+
+        ++validCount;
+        const float floatValue = static_cast<float>(value);
+
+        if (floatValue < outMin)
+        {
+            outMin = floatValue;
+        }
+
+        if (floatValue > outMax)
+        {
+            outMax = floatValue;
+        }
+    }
+
+    return validCount;
+}
+
+// Lanes hold the min/max of their valid values, or +-infinity when they had none. Infinity never wins a strict
+// comparison against the caller values, so folding lanes like cells gives the same result as the scalar loop
+void foldLanes(const float* laneMin, const float* laneMax, int laneCount, float& outMin, float& outMax)
+{
+    for (int i = 0; i < laneCount; ++i)
+    {
+        if (laneMin[i] < outMin)
+        {
+            outMin = laneMin[i];
+        }
+
+        if (laneMax[i] > outMax)
+        {
+            outMax = laneMax[i];
+        }
+    }
+}
+
+#ifdef MIN_MAX_KERNELS_X86
+
+// minps/maxps return their second operand when the first one is NaN, so NaN cells never replace the accumulator
+
+std::size_t maskedMinMaxSse2(const float* data, std::size_t count, float nodata, float& outMin, float& outMax)
+{
+    const __m128 nodataV   = _mm_set1_ps(nodata);
+    const __m128 positiveV = _mm_set1_ps(POSITIVE_INFINITY);
+    const __m128 negativeV = _mm_set1_ps(NEGATIVE_INFINITY);
+
+    __m128  minV   = positiveV;
+    __m128  maxV   = negativeV;
+    __m128i countV = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 value   = _mm_loadu_ps(data + i);
+        const __m128 isValid = _mm_cmpneq_ps(value, nodataV);
+        const __m128 valid   = _mm_and_ps(isValid, value);
+
+        minV   = _mm_min_ps(_mm_or_ps(valid, _mm_andnot_ps(isValid, positiveV)), minV);
+        maxV   = _mm_max_ps(_mm_or_ps(valid, _mm_andnot_ps(isValid, negativeV)), maxV);
+        countV = _mm_sub_epi32(countV, _mm_castps_si128(isValid)); // valid lanes are -1
+    }
+
+    alignas(16) float        laneMin[4];
+    alignas(16) float        laneMax[4];
+    alignas(16) std::int32_t laneCount[4];
+    _mm_store_ps(laneMin, minV);
+    _mm_store_ps(laneMax, maxV);
+    _mm_store_si128(reinterpret_cast<__m128i*>(laneCount), countV);
+
+    foldLanes(laneMin, laneMax, 4, outMin, outMax);
+
+    const std::size_t validCount = static_cast<std::size_t>(laneCount[0]) + laneCount[1] + laneCount[2] + laneCount[3];
+
+    return validCount + maskedMinMaxScalar(data + i, count - i, nodata, outMin, outMax);
+}
+
+std::size_t maskedMinMaxSse2(const double* data, std::size_t count, double nodata, float& outMin, float& outMax)
+{
+    const __m128d nodataV   = _mm_set1_pd(nodata);
+    const __m128d positiveV = _mm_set1_pd(static_cast<double>(POSITIVE_INFINITY));
+    const __m128d negativeV = _mm_set1_pd(static_cast<double>(NEGATIVE_INFINITY));
+
+    __m128  minV   = _mm_set1_ps(POSITIVE_INFINITY);
+    __m128  maxV   = _mm_set1_ps(NEGATIVE_INFINITY);
+    __m128i countV = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128d valueLo = _mm_loadu_pd(data + i);
+        const __m128d valueHi = _mm_loadu_pd(data + i + 2);
+        const __m128d validLo = _mm_cmpneq_pd(valueLo, nodataV);
+        const __m128d validHi = _mm_cmpneq_pd(valueHi, nodataV);
+
+        // Narrowed after masking, the infinities survive the conversion unchanged
+        const __m128d forMinLo = _mm_or_pd(_mm_and_pd(validLo, valueLo), _mm_andnot_pd(validLo, positiveV));
+        const __m128d forMinHi = _mm_or_pd(_mm_and_pd(validHi, valueHi), _mm_andnot_pd(validHi, positiveV));
+        const __m128d forMaxLo = _mm_or_pd(_mm_and_pd(validLo, valueLo), _mm_andnot_pd(validLo, negativeV));
+        const __m128d forMaxHi = _mm_or_pd(_mm_and_pd(validHi, valueHi), _mm_andnot_pd(validHi, negativeV));
+
+        minV = _mm_min_ps(_mm_movelh_ps(_mm_cvtpd_ps(forMinLo), _mm_cvtpd_ps(forMinHi)), minV);
+        maxV = _mm_max_ps(_mm_movelh_ps(_mm_cvtpd_ps(forMaxLo), _mm_cvtpd_ps(forMaxHi)), maxV);
+
+        countV = _mm_sub_epi64(countV, _mm_castpd_si128(validLo));
+        countV = _mm_sub_epi64(countV, _mm_castpd_si128(validHi));
+    }
+
+    alignas(16) float        laneMin[4];
+    alignas(16) float        laneMax[4];
+    alignas(16) std::int64_t laneCount[2];
+    _mm_store_ps(laneMin, minV);
+    _mm_store_ps(laneMax, maxV);
+    _mm_store_si128(reinterpret_cast<__m128i*>(laneCount), countV);
+
+    foldLanes(laneMin, laneMax, 4, outMin, outMax);
+
+    const std::size_t validCount = static_cast<std::size_t>(laneCount[0] + laneCount[1]);
+
+    return validCount + maskedMinMaxScalar(data + i, count - i, nodata, outMin, outMax);
+}
+
+MIN_MAX_TARGET_AVX2
+std::size_t maskedMinMaxAvx2(const float* data, std::size_t count, float nodata, float& outMin, float& outMax)
+{
+    const __m256 nodataV   = _mm256_set1_ps(nodata);
+    const __m256 positiveV = _mm256_set1_ps(POSITIVE_INFINITY);
+    const __m256 negativeV = _mm256_set1_ps(NEGATIVE_INFINITY);
+
+    __m256  minV   = positiveV;
+    __m256  maxV   = negativeV;
+    __m256i countV = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 value   = _mm256_loadu_ps(data + i);
+        const __m256 isValid = _mm256_cmp_ps(value, nodataV, _CMP_NEQ_UQ);
+
+        minV   = _mm256_min_ps(_mm256_blendv_ps(positiveV, value, isValid), minV);
+        maxV   = _mm256_max_ps(_mm256_blendv_ps(negativeV, value, isValid), maxV);
+        countV = _mm256_sub_epi32(countV, _mm256_castps_si256(isValid));
+    }
+
+    alignas(32) float        laneMin[8];
+    alignas(32) float        laneMax[8];
+    alignas(32) std::int32_t laneCount[8];
+    _mm256_store_ps(laneMin, minV);
+    _mm256_store_ps(laneMax, maxV);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(laneCount), countV);
+
+    foldLanes(laneMin, laneMax, 8, outMin, outMax);
+
+    std::size_t validCount = 0;
+    for (const std::int32_t laneValidCount : laneCount)
+    {
+        validCount += static_cast<std::size_t>(laneValidCount);
+    }
+
+    return validCount + maskedMinMaxScalar(data + i, count - i, nodata, outMin, outMax);
+}
+
+MIN_MAX_TARGET_AVX2
+std::size_t maskedMinMaxAvx2(const double* data, std::size_t count, double nodata, float& outMin, float& outMax)
+{
+    const __m256d nodataV   = _mm256_set1_pd(nodata);
+    const __m256d positiveV = _mm256_set1_pd(static_cast<double>(POSITIVE_INFINITY));
+    const __m256d negativeV = _mm256_set1_pd(static_cast<double>(NEGATIVE_INFINITY));
+
+    __m128  minV   = _mm_set1_ps(POSITIVE_INFINITY);
+    __m128  maxV   = _mm_set1_ps(NEGATIVE_INFINITY);
+    __m256i countV = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d value   = _mm256_loadu_pd(data + i);
+        const __m256d isValid = _mm256_cmp_pd(value, nodataV, _CMP_NEQ_UQ);
+
+        minV   = _mm_min_ps(_mm256_cvtpd_ps(_mm256_blendv_pd(positiveV, value, isValid)), minV);
+        maxV   = _mm_max_ps(_mm256_cvtpd_ps(_mm256_blendv_pd(negativeV, value, isValid)), maxV);
+        countV = _mm256_sub_epi64(countV, _mm256_castpd_si256(isValid));
+    }
+
+    alignas(16) float        laneMin[4];
+    alignas(16) float        laneMax[4];
+    alignas(32) std::int64_t laneCount[4];
+    _mm_store_ps(laneMin, minV);
+    _mm_store_ps(laneMax, maxV);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(laneCount), countV);
+
+    foldLanes(laneMin, laneMax, 4, outMin, outMax);
+
+    const std::size_t validCount = static_cast<std::size_t>(laneCount[0] + laneCount[1] + laneCount[2] + laneCount[3]);
+
+    return validCount + maskedMinMaxScalar(data + i, count - i, nodata, outMin, outMax);
+}
+
+bool cpuSupportsAvx2()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // The OS has to save the YMM registers too, not only the CPU support them
+    __cpuid(info, 1);
+    const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+    const bool hasAvx     = (info[2] & (1 << 28)) != 0;
+    if (!hasOsxsave || !hasAvx || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif
+
+MinMaxKernels::Isa detectIsa()
+{
+#ifdef MIN_MAX_KERNELS_X86
+    return cpuSupportsAvx2() ? MinMaxKernels::Isa::Avx2 : MinMaxKernels::Isa::Sse2;
+#else
+    return MinMaxKernels::Isa::Scalar;
+#endif
+}
+
+std::atomic<MinMaxKernels::Isa>& activeIsa()
+{
+    static std::atomic<MinMaxKernels::Isa> isa(detectIsa());
+    return isa;
+}
+
+template <typename T>
+std::size_t dispatch(const T* data, std::size_t count, T nodata, float& outMin, float& outMax)
+{
+    switch (activeIsa().load(std::memory_order_relaxed))
+    {
+#ifdef MIN_MAX_KERNELS_X86
+        case MinMaxKernels::Isa::Avx2:
+            return maskedMinMaxAvx2(data, count, nodata, outMin, outMax);
+        case MinMaxKernels::Isa::Sse2:
+            return maskedMinMaxSse2(data, count, nodata, outMin, outMax);
+#endif
+        default:
+            return maskedMinMaxScalar(data, count, nodata, outMin, outMax);
+    }
+}
+} // namespace
+
+namespace MinMaxKernels
+{
+std::size_t maskedMinMax(const float* data, std::size_t count, float nodata, float& outMin, float& outMax)
+{
+    return dispatch(data, count, nodata, outMin, outMax);
+}
+
+std::size_t maskedMinMax(const double* data, std::size_t count, double nodata, float& outMin, float& outMax)
+{
+    return dispatch(data, count, nodata, outMin, outMax);
+}
+
+Isa getIsa()
+{
+    return activeIsa().load();
+}
+
+bool isIsaSupported(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Scalar:
+            return true;
+#ifdef MIN_MAX_KERNELS_X86
+        case Isa::Sse2:
+            return true;
+        case Isa::Avx2:
+            return cpuSupportsAvx2();
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* getIsaName(Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::Sse2:
+            return "SSE2";
+        case Isa::Avx2:
+            return "AVX2";
+        default:
+            return "Scalar";
+    }
+}
+
+void setIsa(Isa isa)
+{
+    activeIsa().store(isIsaSupported(isa) ? isa : Isa::Scalar);
+}
+} // namespace MinMaxKernels
@@ -0,0 +1,31 @@
+#ifndef MIN_MAX_KERNELS_HPP
+#define MIN_MAX_KERNELS_HPP
+
+#include <cstddef>
+
+// Masked min/max/count over a contiguous span of cells, skipping the ones equal to nodata.
+// Vectorized with SSE2 or AVX2 on x86, the widest one the CPU supports is picked once at runtime.
+// Every path folds values exactly like the scalar loop it replaces: nodata is compared in the storage type,
+// values are narrowed to float before the comparison and NaN cells count as valid but never become min or max
+namespace MinMaxKernels
+{
+enum class Isa
+{
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+// Folds the valid values of [data, data + count) into outMin/outMax and returns how many there were
+std::size_t maskedMinMax(const float* data, std::size_t count, float nodata, float& outMin, float& outMax);
+std::size_t maskedMinMax(const double* data, std::size_t count, double nodata, float& outMin, float& outMax);
+
+Isa         getIsa();
+bool        isIsaSupported(Isa isa);
+const char* getIsaName(Isa isa);
+
+// Mostly for benchmarks. Falls back to Scalar if the CPU does not support the requested one
+void setIsa(Isa isa);
+} // namespace MinMaxKernels
+
+#endif
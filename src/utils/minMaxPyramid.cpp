@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <limits>
+
+#include "minMaxKernels.hpp"
+#include "minMaxPyramid.hpp"
+
+// Min/max of the non nodata cells in [startCol, endCol) x [startRow, endRow). Returns false if all of them are nodata
+template <typename T>
+static bool scanMinMax(const T* data,
+                       int      ncols,
+                       T        nodata,
+                       int      startCol,
+                       int      endCol,
+                       int      startRow,
+                       int      endRow,
+                       float&   outMin,
+                       float&   outMax)
+{
+    const std::size_t rowLength  = static_cast<std::size_t>(endCol - startCol);
+    std::size_t       validCount = 0;
+
+    for (int r = startRow; r < endRow; ++r)
+    {
+        const T* row = data + static_cast<std::size_t>(r) * ncols + startCol;
+        validCount += MinMaxKernels::maskedMinMax(row, rowLength, nodata, outMin, outMax);
+    }
+
+    return validCount > 0;
+}
+
+MinMaxPyramid::MinMaxPyramid(const AscParser& ascData) : m_ascData(ascData)
+{
+    m_ncols = ascData.getHeader().ncols;
+    m_nrows = ascData.getHeader().nrows;
+
+    build();
+}
+
+void MinMaxPyramid::build()
+{
+    Level base;
+    base.width  = (m_ncols + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    base.height = (m_nrows + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    base.nodes.resize(static_cast<std::size_t>(base.width) * base.height);
+
+    for (int by = 0; by < base.height; ++by)
+    {
+        for (int bx = 0; bx < base.width; ++bx)
+        {
+            const Rect block{bx * BLOCK_SIZE,
+                             std::min(m_ncols, (bx + 1) * BLOCK_SIZE),
+                             by * BLOCK_SIZE,
+                             std::min(m_nrows, (by + 1) * BLOCK_SIZE)};
+
+            float blockMin = std::numeric_limits<float>::max();
+            float blockMax = std::numeric_limits<float>::lowest();
+
+            if (scanCells(block, blockMin, blockMax))
+            {
+                Node& node = base.nodes[static_cast<std::size_t>(by) * base.width + bx];
+                node.min   = blockMin;
+                node.max   = blockMax;
+            }
+        }
+    }
+
+    m_levels.clear();
+    m_levels.push_back(std::move(base));
+
+    while (m_levels.back().width > 1 || m_levels.back().height > 1)
+    {
+        const Level& below = m_levels.back();
+
+        Level above;
+        above.width  = (below.width + 1) / 2;
+        above.height = (below.height + 1) / 2;
+        above.nodes.resize(static_cast<std::size_t>(above.width) * above.height);
+
+        for (int y = 0; y < above.height; ++y)
+        {
+            for (int x = 0; x < above.width; ++x)
+            {
+                Node& node = above.nodes[static_cast<std::size_t>(y) * above.width + x];
+
+                for (int cy = 2 * y; cy < std::min(below.height, 2 * y + 2); ++cy)
+                {
+                    for (int cx = 2 * x; cx < std::min(below.width, 2 * x + 2); ++cx)
+                    {
+                        const Node& child = below.nodes[static_cast<std::size_t>(cy) * below.width + cx];
+                        if (!child.hasValue())
+                        {
+                            continue;
+                        }
+
+                        if (!node.hasValue())
+                        {
+                            node = child;
+                            continue;
+                        }
+
+                        node.min = std::min(node.min, child.min);
+                        node.max = std::max(node.max, child.max);
+                    }
+                }
+            }
+        }
+
+        m_levels.push_back(std::move(above));
+    }
+}
+
+bool MinMaxPyramid::query(int startCol, int endCol, int startRow, int endRow, float& outMin, float& outMax) const
+{
+    const Rect rect{std::max(0, startCol), std::min(m_ncols, endCol), std::max(0, startRow), std::min(m_nrows, endRow)};
+
+    if (m_levels.empty() || rect.startCol >= rect.endCol || rect.startRow >= rect.endRow)
+    {
+        return false;
+    }
+
+    bool hasAnyValue = false;
+    queryNode(static_cast<int>(m_levels.size()) - 1, 0, 0, rect, outMin, outMax, hasAnyValue);
+
+    return hasAnyValue;
+}
+
+void MinMaxPyramid::queryNode(
+    int level, int x, int y, const Rect& rect, float& outMin, float& outMax, bool& hasAnyValue) const
+{
+    const Level& current = m_levels[level];
+    if (x >= current.width || y >= current.height)
+    {
+        return;
+    }
+
+    const Node& node = current.nodes[static_cast<std::size_t>(y) * current.width + x];
+    if (!node.hasValue())
+    {
+        return;
+    }
+
+    const int  span = BLOCK_SIZE << level;
+    const Rect nodeRect{x * span, std::min(m_ncols, (x + 1) * span), y * span, std::min(m_nrows, (y + 1) * span)};
+    const Rect overlap{std::max(rect.startCol, nodeRect.startCol),
+                       std::min(rect.endCol, nodeRect.endCol),
+                       std::max(rect.startRow, nodeRect.startRow),
+                       std::min(rect.endRow, nodeRect.endRow)};
+
+    if (overlap.startCol >= overlap.endCol || overlap.startRow >= overlap.endRow)
+    {
+        return;
+    }
+
+    const bool isCovered = overlap.startCol == nodeRect.startCol && overlap.endCol == nodeRect.endCol &&
+                           overlap.startRow == nodeRect.startRow && overlap.endRow == nodeRect.endRow;
+
+    if (isCovered)
+    {
+        hasAnyValue = true;
+        outMin      = std::min(outMin, node.min);
+        outMax      = std::max(outMax, node.max);
+
+        return;
+    }
+
+    if (level == 0)
+    {
+        hasAnyValue = scanCells(overlap, outMin, outMax) || hasAnyValue;
+
+        return;
+    }
+
+    for (int cy = 2 * y; cy < 2 * y + 2; ++cy)
+    {
+        for (int cx = 2 * x; cx < 2 * x + 2; ++cx)
+        {
+            queryNode(level - 1, cx, cy, rect, outMin, outMax, hasAnyValue);
+        }
+    }
+}
+
+bool MinMaxPyramid::scanCells(const Rect& rect, float& outMin, float& outMax) const
+{
+    const double nodata = m_ascData.getHeader().nodata_value;
+
+    if (const float* floatData = m_ascData.getFloatData())
+    {
+        return scanMinMax(floatData,
+                          m_ncols,
+                          static_cast<float>(nodata),
+                          rect.startCol,
+                          rect.endCol,
+                          rect.startRow,
+                          rect.endRow,
+                          outMin,
+                          outMax);
+    }
+
+    return scanMinMax(m_ascData.getDoubleData(),
+                      m_ncols,
+                      nodata,
+                      rect.startCol,
+                      rect.endCol,
+                      rect.startRow,
+                      rect.endRow,
+                      outMin,
+                      outMax);
+}
+
+std::size_t MinMaxPyramid::getMemoryUsage() const
+{
+    std::size_t bytes = 0;
+
+    for (const Level& level : m_levels)
+    {
+        bytes += level.nodes.size() * sizeof(Node);
+    }
+
+    return bytes;
+}
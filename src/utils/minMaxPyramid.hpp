@@ -0,0 +1,63 @@
+#ifndef MIN_MAX_PYRAMID_HPP
+#define MIN_MAX_PYRAMID_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "ascParser.hpp"
+
+// Min/max mip pyramid over the valid (non nodata) cells of an ASC grid.
+// Level 0 holds BLOCK_SIZE x BLOCK_SIZE cell blocks and every level above merges 2x2 nodes of the one below.
+// A rectangle query takes whole nodes where they fit and only scans cells along its border, with the same float
+// comparisons as a brute force scan so results are identical. The parser must outlive the pyramid
+class MinMaxPyramid
+{
+public:
+    static constexpr int BLOCK_SIZE = 16;
+
+    MinMaxPyramid(const AscParser& ascData);
+
+    // Folds the valid cells of [startCol, endCol) x [startRow, endRow) into outMin/outMax.
+    // Returns false if all of them are nodata
+    bool query(int startCol, int endCol, int startRow, int endRow, float& outMin, float& outMax) const;
+
+    std::size_t getMemoryUsage() const;
+
+private:
+    // A node without valid cells keeps NaN bounds, the scans never fold NaN in, which keeps a node at 8 bytes
+    struct Node
+    {
+        float min = std::numeric_limits<float>::quiet_NaN();
+        float max = std::numeric_limits<float>::quiet_NaN();
+
+        bool hasValue() const { return !std::isnan(min); }
+    };
+
+    struct Level
+    {
+        int               width  = 0; // in nodes
+        int               height = 0;
+        std::vector<Node> nodes;
+    };
+
+    struct Rect
+    {
+        int startCol;
+        int endCol;
+        int startRow;
+        int endRow;
+    };
+
+    const AscParser&   m_ascData;
+    int                m_ncols = 0;
+    int                m_nrows = 0;
+    std::vector<Level> m_levels;
+
+    void build();
+    void queryNode(int level, int x, int y, const Rect& rect, float& outMin, float& outMax, bool& hasAnyValue) const;
+    bool scanCells(const Rect& rect, float& outMin, float& outMax) const;
+};
+
+#endif
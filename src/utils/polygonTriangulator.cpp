@@ -0,0 +1,750 @@
+// The triangulation is a port of earcut (https://github.com/mapbox/earcut), used under the ISC License:
+//
+// ISC License
+//
+// Copyright (c) 2016, Mapbox
+//
+// Permission to use, copy, modify, and/or distribute this software for any purpose
+// with or without fee is hereby granted, provided that the above copyright notice
+// and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH REGARD TO
+// THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+// IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA
+// OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,
+// ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "polygonTriangulator.hpp"
+
+static bool isPointInTriangle(double ax, double ay, double bx, double by, double cx, double cy, double px, double py)
+{
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) && (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+static int sign(double value)
+{
+    return (value > 0.0) - (value < 0.0);
+}
+
+void PolygonTriangulator::triangulate(const sf::Vector2f*      points,
+                                      const std::vector<Ring>& rings,
+                                      std::vector<uint32_t>&   outIndices)
+{
+    m_nodes.clear();
+
+    if (rings.empty())
+    {
+        return;
+    }
+
+    int outer = linkRing(points, rings[0], true);
+    if (outer < 0 || m_nodes[outer].next == m_nodes[outer].prev)
+    {
+        return;
+    }
+
+    m_invSize = 0.0;
+
+    std::size_t pointCount = 0;
+    for (const Ring& ring : rings)
+    {
+        pointCount += ring.count;
+    }
+
+    if (pointCount > HASH_THRESHOLD)
+    {
+        const sf::Vector2f* first = points + rings[0].first;
+
+        m_minX      = first->x;
+        m_minY      = first->y;
+        double maxX = m_minX;
+        double maxY = m_minY;
+
+        for (uint32_t i = 1; i < rings[0].count; ++i)
+        {
+            m_minX = std::min<double>(m_minX, first[i].x);
+            m_minY = std::min<double>(m_minY, first[i].y);
+            maxX   = std::max<double>(maxX, first[i].x);
+            maxY   = std::max<double>(maxY, first[i].y);
+        }
+
+        // Morton codes use 15 bits per axis
+        const double size = std::max(maxX - m_minX, maxY - m_minY);
+        m_invSize         = size != 0.0 ? 32767.0 / size : 0.0;
+    }
+
+    m_holes.clear();
+    for (std::size_t i = 1; i < rings.size(); ++i)
+    {
+        const int hole = linkRing(points, rings[i], false);
+        if (hole < 0)
+        {
+            continue;
+        }
+
+        if (m_nodes[hole].next == hole)
+        {
+            m_nodes[hole].steiner = true;
+        }
+
+        m_holes.push_back(getLeftmost(hole));
+    }
+
+    // Bridged from left to right, so each bridge is searched on the ring the previous holes left
+    std::sort(m_holes.begin(),
+              m_holes.end(),
+              [&](int a, int b)
+              { return m_nodes[a].x < m_nodes[b].x || (m_nodes[a].x == m_nodes[b].x && m_nodes[a].y < m_nodes[b].y); });
+
+    for (const int hole : m_holes)
+    {
+        outer = eliminateHole(hole, outer);
+    }
+
+    clipEars(outer, outIndices, 0);
+}
+
+int PolygonTriangulator::linkRing(const sf::Vector2f* points, const Ring& ring, bool clockwise)
+{
+    if (ring.count == 0)
+    {
+        return -1;
+    }
+
+    double signedArea = 0.0;
+    for (uint32_t i = 0, j = ring.count - 1; i < ring.count; j = i++)
+    {
+        const sf::Vector2f& a = points[ring.first + i];
+        const sf::Vector2f& b = points[ring.first + j];
+        signedArea += (static_cast<double>(b.x) - a.x) * (static_cast<double>(a.y) + b.y);
+    }
+
+    int last = -1;
+    if (clockwise == (signedArea > 0.0))
+    {
+        for (uint32_t i = 0; i < ring.count; ++i)
+        {
+            last = insertNode(ring.first + i, points[ring.first + i], last);
+        }
+    }
+    else
+    {
+        for (uint32_t i = ring.count; i-- > 0;)
+        {
+            last = insertNode(ring.first + i, points[ring.first + i], last);
+        }
+    }
+
+    // Drops the closing point of WKT rings
+    if (last >= 0 && equals(last, m_nodes[last].next))
+    {
+        const int next = m_nodes[last].next;
+        removeNode(last);
+        last = next;
+    }
+
+    return last;
+}
+
+int PolygonTriangulator::insertNode(uint32_t index, const sf::Vector2f& point, int last)
+{
+    const int node = static_cast<int>(m_nodes.size());
+
+    Node created;
+    created.index = index;
+    created.x     = point.x;
+    created.y     = point.y;
+
+    if (last < 0)
+    {
+        created.prev = node;
+        created.next = node;
+        m_nodes.push_back(created);
+    }
+    else
+    {
+        created.prev = last;
+        created.next = m_nodes[last].next;
+        m_nodes.push_back(created);
+
+        m_nodes[m_nodes[last].next].prev = node;
+        m_nodes[last].next               = node;
+    }
+
+    return node;
+}
+
+void PolygonTriangulator::removeNode(int node)
+{
+    const Node& removed = m_nodes[node];
+
+    m_nodes[removed.next].prev = removed.prev;
+    m_nodes[removed.prev].next = removed.next;
+
+    if (removed.prevZ >= 0)
+    {
+        m_nodes[removed.prevZ].nextZ = removed.nextZ;
+    }
+
+    if (removed.nextZ >= 0)
+    {
+        m_nodes[removed.nextZ].prevZ = removed.prevZ;
+    }
+}
+
+// Removes duplicate and collinear points between start and end
+int PolygonTriangulator::filterPoints(int start, int end)
+{
+    if (start < 0)
+    {
+        return start;
+    }
+
+    if (end < 0)
+    {
+        end = start;
+    }
+
+    int  p = start;
+    bool again;
+
+    do
+    {
+        again = false;
+
+        const Node& node = m_nodes[p];
+        if (!node.steiner && (equals(p, node.next) || area(node.prev, p, node.next) == 0.0))
+        {
+            removeNode(p);
+            p = end = node.prev;
+
+            if (p == m_nodes[p].next)
+            {
+                break;
+            }
+
+            again = true;
+        }
+        else
+        {
+            p = node.next;
+        }
+    } while (again || p != end);
+
+    return end;
+}
+
+// Pass 0 clips plain ears, 1 retries after filtering points, 2 cures small self intersections and the last resort
+// splits the remaining loop in two along a valid diagonal
+void PolygonTriangulator::clipEars(int ear, std::vector<uint32_t>& outIndices, int pass)
+{
+    if (ear < 0)
+    {
+        return;
+    }
+
+    if (pass == 0 && m_invSize != 0.0)
+    {
+        indexCurve(ear);
+    }
+
+    int stop = ear;
+
+    while (m_nodes[ear].prev != m_nodes[ear].next)
+    {
+        const int prev = m_nodes[ear].prev;
+        const int next = m_nodes[ear].next;
+
+        if (m_invSize != 0.0 ? isEarHashed(ear) : isEar(ear))
+        {
+            outIndices.push_back(m_nodes[prev].index);
+            outIndices.push_back(m_nodes[ear].index);
+            outIndices.push_back(m_nodes[next].index);
+
+            removeNode(ear);
+
+            ear  = m_nodes[next].next;
+            stop = ear;
+
+            continue;
+        }
+
+        ear = next;
+
+        if (ear == stop)
+        {
+            if (pass == 0)
+            {
+                clipEars(filterPoints(ear), outIndices, 1);
+            }
+            else if (pass == 1)
+            {
+                ear = cureLocalIntersections(filterPoints(ear), outIndices);
+                clipEars(ear, outIndices, 2);
+            }
+            else
+            {
+                splitAndClip(ear, outIndices);
+            }
+
+            break;
+        }
+    }
+}
+
+bool PolygonTriangulator::isEar(int ear) const
+{
+    const Node& a = m_nodes[m_nodes[ear].prev];
+    const Node& b = m_nodes[ear];
+    const Node& c = m_nodes[b.next];
+
+    // Reflex
+    if (area(b.prev, ear, b.next) >= 0.0)
+    {
+        return false;
+    }
+
+    const double minX = std::min({a.x, b.x, c.x});
+    const double minY = std::min({a.y, b.y, c.y});
+    const double maxX = std::max({a.x, b.x, c.x});
+    const double maxY = std::max({a.y, b.y, c.y});
+
+    // No other point may lie inside the ear
+    for (int p = c.next; p != b.prev; p = m_nodes[p].next)
+    {
+        const Node& node = m_nodes[p];
+
+        if (node.x >= minX && node.x <= maxX && node.y >= minY && node.y <= maxY && isPointInEar(p, a, b, c))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Same as isEar, but walks the Morton ordered list both ways from the ear and stops outside the codes of its bounds
+bool PolygonTriangulator::isEarHashed(int ear) const
+{
+    const Node& a = m_nodes[m_nodes[ear].prev];
+    const Node& b = m_nodes[ear];
+    const Node& c = m_nodes[b.next];
+
+    if (area(b.prev, ear, b.next) >= 0.0)
+    {
+        return false;
+    }
+
+    const double minX = std::min({a.x, b.x, c.x});
+    const double minY = std::min({a.y, b.y, c.y});
+    const double maxX = std::max({a.x, b.x, c.x});
+    const double maxY = std::max({a.y, b.y, c.y});
+
+    const uint32_t minZ = getZOrder(minX, minY);
+    const uint32_t maxZ = getZOrder(maxX, maxY);
+
+    auto blocksEar = [&](int p)
+    {
+        const Node& node = m_nodes[p];
+
+        return node.x >= minX && node.x <= maxX && node.y >= minY && node.y <= maxY && p != b.prev && p != b.next &&
+               isPointInEar(p, a, b, c);
+    };
+
+    int p = b.prevZ;
+    int n = b.nextZ;
+
+    while (p >= 0 && m_nodes[p].z >= minZ && n >= 0 && m_nodes[n].z <= maxZ)
+    {
+        if (blocksEar(p) || blocksEar(n))
+        {
+            return false;
+        }
+
+        p = m_nodes[p].prevZ;
+        n = m_nodes[n].nextZ;
+    }
+
+    for (; p >= 0 && m_nodes[p].z >= minZ; p = m_nodes[p].prevZ)
+    {
+        if (blocksEar(p))
+        {
+            return false;
+        }
+    }
+
+    for (; n >= 0 && m_nodes[n].z <= maxZ; n = m_nodes[n].nextZ)
+    {
+        if (blocksEar(n))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// A reflex point inside the ear, other than one sitting on its first corner (bridges duplicate points)
+bool PolygonTriangulator::isPointInEar(int p, const Node& a, const Node& b, const Node& c) const
+{
+    const Node& node = m_nodes[p];
+
+    return !(node.x == a.x && node.y == a.y) && isPointInTriangle(a.x, a.y, b.x, b.y, c.x, c.y, node.x, node.y) &&
+           area(node.prev, p, node.next) >= 0.0;
+}
+
+// Links the nodes of the loop in Morton order
+void PolygonTriangulator::indexCurve(int start)
+{
+    m_sortScratch.clear();
+
+    int p = start;
+    do
+    {
+        m_nodes[p].z = getZOrder(m_nodes[p].x, m_nodes[p].y);
+        m_sortScratch.push_back(p);
+        p = m_nodes[p].next;
+    } while (p != start);
+
+    std::sort(m_sortScratch.begin(), m_sortScratch.end(), [&](int a, int b) { return m_nodes[a].z < m_nodes[b].z; });
+
+    for (std::size_t i = 0; i < m_sortScratch.size(); ++i)
+    {
+        Node& node = m_nodes[m_sortScratch[i]];
+        node.prevZ = i > 0 ? m_sortScratch[i - 1] : -1;
+        node.nextZ = i + 1 < m_sortScratch.size() ? m_sortScratch[i + 1] : -1;
+    }
+}
+
+uint32_t PolygonTriangulator::getZOrder(double x, double y) const
+{
+    // Interleaves the bits of both coordinates scaled to 15 bits. Holes poking out of the outer ring are clamped
+    uint32_t zx = static_cast<uint32_t>(std::clamp((x - m_minX) * m_invSize, 0.0, 32767.0));
+    uint32_t zy = static_cast<uint32_t>(std::clamp((y - m_minY) * m_invSize, 0.0, 32767.0));
+
+    zx = (zx | (zx << 8)) & 0x00FF00FF;
+    zx = (zx | (zx << 4)) & 0x0F0F0F0F;
+    zx = (zx | (zx << 2)) & 0x33333333;
+    zx = (zx | (zx << 1)) & 0x55555555;
+
+    zy = (zy | (zy << 8)) & 0x00FF00FF;
+    zy = (zy | (zy << 4)) & 0x0F0F0F0F;
+    zy = (zy | (zy << 2)) & 0x33333333;
+    zy = (zy | (zy << 1)) & 0x55555555;
+
+    return zx | (zy << 1);
+}
+
+int PolygonTriangulator::cureLocalIntersections(int start, std::vector<uint32_t>& outIndices)
+{
+    int p = start;
+
+    do
+    {
+        const int a = m_nodes[p].prev;
+        const int b = m_nodes[m_nodes[p].next].next;
+
+        if (!equals(a, b) && intersects(a, p, m_nodes[p].next, b) && isLocallyInside(a, b) && isLocallyInside(b, a))
+        {
+            outIndices.push_back(m_nodes[a].index);
+            outIndices.push_back(m_nodes[p].index);
+            outIndices.push_back(m_nodes[b].index);
+
+            removeNode(m_nodes[p].next);
+            removeNode(p);
+
+            p = start = b;
+        }
+
+        p = m_nodes[p].next;
+    } while (p != start);
+
+    return filterPoints(p);
+}
+
+void PolygonTriangulator::splitAndClip(int start, std::vector<uint32_t>& outIndices)
+{
+    int a = start;
+
+    do
+    {
+        for (int b = m_nodes[m_nodes[a].next].next; b != m_nodes[a].prev; b = m_nodes[b].next)
+        {
+            if (m_nodes[a].index != m_nodes[b].index && isValidDiagonal(a, b))
+            {
+                int c = splitPolygon(a, b);
+
+                a = filterPoints(a, m_nodes[a].next);
+                c = filterPoints(c, m_nodes[c].next);
+
+                clipEars(a, outIndices, 0);
+                clipEars(c, outIndices, 0);
+
+                return;
+            }
+        }
+
+        a = m_nodes[a].next;
+    } while (a != start);
+}
+
+int PolygonTriangulator::eliminateHole(int hole, int outer)
+{
+    const int bridge = findHoleBridge(hole, outer);
+    if (bridge < 0)
+    {
+        return outer;
+    }
+
+    const int bridgeReverse = splitPolygon(bridge, hole);
+    filterPoints(bridgeReverse, m_nodes[bridgeReverse].next);
+
+    return filterPoints(bridge, m_nodes[bridge].next);
+}
+
+// Finds an outer ring point visible from the leftmost point of the hole, by casting a ray to the left
+int PolygonTriangulator::findHoleBridge(int hole, int outer) const
+{
+    const double hx = m_nodes[hole].x;
+    const double hy = m_nodes[hole].y;
+    double       qx = -std::numeric_limits<double>::infinity();
+    int          m  = -1;
+
+    int p = outer;
+    do
+    {
+        const Node& node = m_nodes[p];
+        const Node& next = m_nodes[node.next];
+
+        if (hy <= node.y && hy >= next.y && next.y != node.y)
+        {
+            const double x = node.x + (hy - node.y) * (next.x - node.x) / (next.y - node.y);
+            if (x <= hx && x > qx)
+            {
+                qx = x;
+                m  = node.x < next.x ? p : node.next;
+
+                // The hole touches the segment
+                if (x == hx)
+                {
+                    return m;
+                }
+            }
+        }
+
+        p = node.next;
+    } while (p != outer);
+
+    if (m < 0)
+    {
+        return -1;
+    }
+
+    // Look for points inside the triangle of the hole point, the segment intersection and its endpoint. If there are
+    // none the endpoint is visible, otherwise the one with the smallest angle to the ray is the connection point
+    const int    stop   = m;
+    const double mx     = m_nodes[m].x;
+    const double my     = m_nodes[m].y;
+    double       tanMin = std::numeric_limits<double>::infinity();
+
+    p = m;
+    do
+    {
+        const Node& node = m_nodes[p];
+
+        if (hx >= node.x && node.x >= mx && hx != node.x &&
+            isPointInTriangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, node.x, node.y))
+        {
+            const double tan = std::abs(hy - node.y) / (hx - node.x);
+
+            if (isLocallyInside(p, hole) &&
+                (tan < tanMin ||
+                 (tan == tanMin && (node.x > m_nodes[m].x || (node.x == m_nodes[m].x && sectorContainsSector(m, p))))))
+            {
+                m      = p;
+                tanMin = tan;
+            }
+        }
+
+        p = node.next;
+    } while (p != stop);
+
+    return m;
+}
+
+// Links a and b with a bridge. If they are on the same ring it is split in two, otherwise the rings are merged.
+// Returns the copy of b, the start of the second loop
+int PolygonTriangulator::splitPolygon(int a, int b)
+{
+    const int a2 = static_cast<int>(m_nodes.size());
+    const int b2 = a2 + 1;
+
+    Node copyA    = m_nodes[a];
+    Node copyB    = m_nodes[b];
+    copyA.steiner = false;
+    copyB.steiner = false;
+    copyA.prevZ   = copyA.nextZ = -1;
+    copyB.prevZ   = copyB.nextZ = -1;
+
+    const int an = m_nodes[a].next;
+    const int bp = m_nodes[b].prev;
+
+    m_nodes[a].next = b;
+    m_nodes[b].prev = a;
+
+    copyA.next = an;
+    copyA.prev = b2;
+    copyB.next = a2;
+    copyB.prev = bp;
+
+    m_nodes.push_back(copyA);
+    m_nodes.push_back(copyB);
+
+    m_nodes[an].prev = a2;
+    m_nodes[bp].next = b2;
+
+    return b2;
+}
+
+int PolygonTriangulator::getLeftmost(int start) const
+{
+    int p        = start;
+    int leftmost = start;
+
+    do
+    {
+        if (m_nodes[p].x < m_nodes[leftmost].x ||
+            (m_nodes[p].x == m_nodes[leftmost].x && m_nodes[p].y < m_nodes[leftmost].y))
+        {
+            leftmost = p;
+        }
+
+        p = m_nodes[p].next;
+    } while (p != start);
+
+    return leftmost;
+}
+
+bool PolygonTriangulator::isValidDiagonal(int a, int b) const
+{
+    const Node& nodeA = m_nodes[a];
+    const Node& nodeB = m_nodes[b];
+
+    if (m_nodes[nodeA.next].index == nodeB.index || m_nodes[nodeA.prev].index == nodeB.index || intersectsPolygon(a, b))
+    {
+        return false;
+    }
+
+    // Locally visible and not degenerate, or a zero length diagonal between two convex corners
+    return (isLocallyInside(a, b) && isLocallyInside(b, a) && isMiddleInside(a, b) &&
+            (area(nodeA.prev, a, nodeB.prev) != 0.0 || area(a, nodeB.prev, b) != 0.0)) ||
+           (equals(a, b) && area(nodeA.prev, a, nodeA.next) > 0.0 && area(nodeB.prev, b, nodeB.next) > 0.0);
+}
+
+bool PolygonTriangulator::intersectsPolygon(int a, int b) const
+{
+    const uint32_t indexA = m_nodes[a].index;
+    const uint32_t indexB = m_nodes[b].index;
+
+    int p = a;
+    do
+    {
+        const int next = m_nodes[p].next;
+
+        if (m_nodes[p].index != indexA && m_nodes[next].index != indexA && m_nodes[p].index != indexB &&
+            m_nodes[next].index != indexB && intersects(p, next, a, b))
+        {
+            return true;
+        }
+
+        p = next;
+    } while (p != a);
+
+    return false;
+}
+
+bool PolygonTriangulator::isLocallyInside(int a, int b) const
+{
+    const Node& nodeA = m_nodes[a];
+
+    return area(nodeA.prev, a, nodeA.next) < 0.0
+               ? area(a, b, nodeA.next) >= 0.0 && area(a, nodeA.prev, b) >= 0.0
+               : area(a, b, nodeA.prev) < 0.0 || area(a, nodeA.next, b) < 0.0;
+}
+
+bool PolygonTriangulator::isMiddleInside(int a, int b) const
+{
+    const double px = (m_nodes[a].x + m_nodes[b].x) / 2.0;
+    const double py = (m_nodes[a].y + m_nodes[b].y) / 2.0;
+
+    bool isInside = false;
+    int  p        = a;
+
+    do
+    {
+        const Node& node = m_nodes[p];
+        const Node& next = m_nodes[node.next];
+
+        if ((node.y > py) != (next.y > py) && next.y != node.y &&
+            px < (next.x - node.x) * (py - node.y) / (next.y - node.y) + node.x)
+        {
+            isInside = !isInside;
+        }
+
+        p = node.next;
+    } while (p != a);
+
+    return isInside;
+}
+
+bool PolygonTriangulator::sectorContainsSector(int m, int p) const
+{
+    return area(m_nodes[m].prev, m, m_nodes[p].prev) < 0.0 && area(m_nodes[p].next, m, m_nodes[m].next) < 0.0;
+}
+
+double PolygonTriangulator::area(int p, int q, int r) const
+{
+    const Node& a = m_nodes[p];
+    const Node& b = m_nodes[q];
+    const Node& c = m_nodes[r];
+
+    return (b.y - a.y) * (c.x - b.x) - (b.x - a.x) * (c.y - b.y);
+}
+
+bool PolygonTriangulator::equals(int a, int b) const
+{
+    return m_nodes[a].x == m_nodes[b].x && m_nodes[a].y == m_nodes[b].y;
+}
+
+bool PolygonTriangulator::intersects(int p1, int q1, int p2, int q2) const
+{
+    auto isOnSegment = [&](int p, int q, int r)
+    {
+        const Node& a = m_nodes[p];
+        const Node& b = m_nodes[q];
+        const Node& c = m_nodes[r];
+
+        return b.x <= std::max(a.x, c.x) && b.x >= std::min(a.x, c.x) && b.y <= std::max(a.y, c.y) &&
+               b.y >= std::min(a.y, c.y);
+    };
+
+    const int o1 = sign(area(p1, q1, p2));
+    const int o2 = sign(area(p1, q1, q2));
+    const int o3 = sign(area(p2, q2, p1));
+    const int o4 = sign(area(p2, q2, q1));
+
+    if (o1 != o2 && o3 != o4)
+    {
+        return true;
+    }
+
+    // Collinear cases
+    return (o1 == 0 && isOnSegment(p1, p2, q1)) || (o2 == 0 && isOnSegment(p1, q2, q1)) ||
+           (o3 == 0 && isOnSegment(p2, p1, q2)) || (o4 == 0 && isOnSegment(p2, q1, q2));
+}
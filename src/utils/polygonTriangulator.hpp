@@ -0,0 +1,98 @@
+// The triangulation is a port of earcut (https://github.com/mapbox/earcut), used under the ISC License:
+//
+// ISC License
+//
+// Copyright (c) 2016, Mapbox
+//
+// Permission to use, copy, modify, and/or distribute this software for any purpose
+// with or without fee is hereby granted, provided that the above copyright notice
+// and this permission notice appear in all copies.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND ISC DISCLAIMS ALL WARRANTIES WITH REGARD TO
+// THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS.
+// IN NO EVENT SHALL ISC BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA
+// OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION,
+// ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#ifndef POLYGON_TRIANGULATOR_HPP
+#define POLYGON_TRIANGULATOR_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+// Ear clipping triangulation of polygons with holes, ported from mapbox/earcut (see the notice above): holes are
+// bridged into the outer ring, ears are clipped, and when none is left the remaining loop is cured of local self
+// intersections and finally split along a valid diagonal. Always terminates, bad input (self intersecting rings)
+// may leave gaps.
+// Node storage is kept between calls, so reuse one instance for many polygons
+class PolygonTriangulator
+{
+public:
+    struct Ring
+    {
+        uint32_t first = 0; // [first, first + count) in the points array
+        uint32_t count = 0;
+    };
+
+    // rings[0] is the outer ring and the others are holes, closing points repeating the first one are ignored.
+    // Appends three indices into points per triangle to outIndices
+    void triangulate(const sf::Vector2f* points, const std::vector<Ring>& rings, std::vector<uint32_t>& outIndices);
+
+private:
+    struct Node
+    {
+        uint32_t index   = 0; // into the points array
+        double   x       = 0.0;
+        double   y       = 0.0;
+        int      prev    = -1;
+        int      next    = -1;
+        uint32_t z       = 0; // Morton code, orders the nodes in the prevZ/nextZ list
+        int      prevZ   = -1;
+        int      nextZ   = -1;
+        bool     steiner = false;
+    };
+
+    // Above this many points ear tests only look at the nodes whose Morton code is within the ear bounds
+    static constexpr std::size_t HASH_THRESHOLD = 80;
+
+    std::vector<Node> m_nodes;
+    std::vector<int>  m_holes;
+    std::vector<int>  m_sortScratch;
+
+    double m_minX    = 0.0;
+    double m_minY    = 0.0;
+    double m_invSize = 0.0; // 0 disables the Morton order
+
+    int  linkRing(const sf::Vector2f* points, const Ring& ring, bool clockwise);
+    int  insertNode(uint32_t index, const sf::Vector2f& point, int last);
+    void removeNode(int node);
+    int  filterPoints(int start, int end = -1);
+    void clipEars(int ear, std::vector<uint32_t>& outIndices, int pass);
+    bool isEar(int ear) const;
+    bool isEarHashed(int ear) const;
+    void indexCurve(int start);
+    bool isPointInEar(int p, const Node& a, const Node& b, const Node& c) const;
+
+    uint32_t getZOrder(double x, double y) const;
+    int  cureLocalIntersections(int start, std::vector<uint32_t>& outIndices);
+    void splitAndClip(int start, std::vector<uint32_t>& outIndices);
+    int  eliminateHole(int hole, int outer);
+    int  findHoleBridge(int hole, int outer) const;
+    int  splitPolygon(int a, int b);
+    int  getLeftmost(int start) const;
+
+    bool isValidDiagonal(int a, int b) const;
+    bool intersectsPolygon(int a, int b) const;
+    bool isLocallyInside(int a, int b) const;
+    bool isMiddleInside(int a, int b) const;
+    bool sectorContainsSector(int m, int p) const;
+
+    double area(int p, int q, int r) const;
+    bool   equals(int a, int b) const;
+    bool   intersects(int p1, int q1, int p2, int q2) const;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef RUN_ON_THREADS_HPP
+#define RUN_ON_THREADS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Runs task(i) for every i in [0, count), each on its own thread. The calling thread takes the last index
+template <typename Task>
+void runOnThreads(std::size_t count, const Task& task)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+
+    try
+    {
+        for (std::size_t i = 0; i + 1 < count; ++i)
+        {
+            threads.emplace_back(std::cref(task), i);
+        }
+
+        task(count - 1);
+    } catch (...)
+    {
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        throw;
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+#endif
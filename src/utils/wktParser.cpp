@@ -1,82 +1,74 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <limits>
 #include <stdexcept>
 
 #include "wktParser.hpp"
 
-static std::string toLower(const std::string& str)
+static bool isSpace(char c)
 {
-    std::string lower_str = str;
-
-    for (char& c : lower_str)
-    {
-        c = std::tolower(c);
-    }
-
-    return lower_str;
-}
-
-// Trimming reference at https://stackoverflow.com/questions/216823/how-can-i-trim-a-stdstring
-static void ltrim(std::string& s)
-{
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char c) { return !std::isspace(c); }));
-}
-
-static void rtrim(std::string& s)
-{
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char c) { return !std::isspace(c); }).base(), s.end());
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
 }
 
-static void trim(std::string& s)
+static bool isDigit(char c)
 {
-    ltrim(s);
-    rtrim(s);
+    return c >= '0' && c <= '9';
 }
 
-static GeoCsvParser::GeometryType baseGeomType(const std::string& lowerType)
+static std::string_view trim(std::string_view s)
 {
-    if (lowerType.rfind("point", 0) == 0)
+    while (!s.empty() && isSpace(s.front()))
     {
-        return GeoCsvParser::GeometryType::Point;
+        s.remove_prefix(1);
     }
 
-    if (lowerType.rfind("linestring", 0) == 0)
+    while (!s.empty() && isSpace(s.back()))
     {
-        return GeoCsvParser::GeometryType::LineString;
+        s.remove_suffix(1);
     }
 
-    if (lowerType.rfind("multilinestring", 0) == 0)
-    {
-        return GeoCsvParser::GeometryType::MultiLineString;
-    }
+    return s;
+}
 
-    if (lowerType.rfind("polygon", 0) == 0)
-    {
-        return GeoCsvParser::GeometryType::Polygon;
-    }
+static std::string toLower(std::string_view str)
+{
+    std::string lower_str(str);
 
-    if (lowerType.rfind("multipolygon", 0) == 0)
+    for (char& c : lower_str)
     {
-        return GeoCsvParser::GeometryType::MultiPolygon;
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
     }
 
-    return GeoCsvParser::GeometryType::Unknown;
+    return lower_str;
 }
 
+// Case insensitive prefix test, keywords are always lower case
+static bool startsWithKeyword(std::string_view word, std::string_view keyword)
+{
+    return word.size() >= keyword.size() &&
+           std::equal(keyword.begin(),
+                      keyword.end(),
+                      word.begin(),
+                      [](char k, char w) { return k == std::tolower(static_cast<unsigned char>(w)); });
+}
 
-WktParser::WktParser(std::string src) : wktString(std::move(src))
+WktParser::WktParser(std::string_view src) : wktString(trim(src))
 {
-    trim(wktString);
 }
 
-GeoCsvParser::Geometry WktParser::parse()
+GeoCsvParser::Geometry WktParser::parse(GeoCsvParser::GeometryStore& outStore)
 {
+    store = &outStore;
     skipWhiteSpace();
 
-    std::string type = readWord();
-    auto        base = baseGeomType(type);
+    const std::string_view type = readWord();
+    auto                   base = baseGeomType(type);
 
     skipOptionalDimensionToken();
 
     GeoCsvParser::Geometry g;
+    g.firstPart = store->getPartCount();
 
     switch (base)
     {
@@ -93,7 +85,7 @@ GeoCsvParser::Geometry WktParser::parse()
         case GeoCsvParser::GeometryType::LineString:
         {
             g.type = GeoCsvParser::GeometryType::LineString;
-            g.lines.push_back(readLineString());
+            readLineString();
             break;
         }
         case GeoCsvParser::GeometryType::MultiLineString:
@@ -103,7 +95,7 @@ GeoCsvParser::Geometry WktParser::parse()
 
             do
             {
-                g.lines.push_back(readLineString());
+                readLineString();
             } while (consume(','));
 
             expect(')');
@@ -113,7 +105,7 @@ GeoCsvParser::Geometry WktParser::parse()
         case GeoCsvParser::GeometryType::Polygon:
         {
             g.type = GeoCsvParser::GeometryType::Polygon;
-            g.polygons.push_back(readPolygon());
+            readPolygon();
 
             break;
         }
@@ -124,7 +116,7 @@ GeoCsvParser::Geometry WktParser::parse()
 
             do
             {
-                g.polygons.push_back(readPolygon());
+                readPolygon();
             } while (consume(','));
 
             expect(')');
@@ -133,20 +125,20 @@ GeoCsvParser::Geometry WktParser::parse()
         }
         default:
         {
-            throw std::runtime_error("WKT unsupported geometry type: " + type);
+            throw std::runtime_error("WKT unsupported geometry type: " + toLower(type));
         }
     }
 
+    g.partCount = store->getPartCount() - g.firstPart;
     skipWhiteSpace();
 
     if (pos != wktString.size())
     {
-        std::string rest = std::string(wktString.begin() + static_cast<long>(pos), wktString.end());
-        trim(rest);
+        const std::string_view rest = trim(wktString.substr(pos));
 
         if (!rest.empty())
         {
-            throw std::runtime_error("WKT unexpected trailing input: " + rest);
+            throw std::runtime_error("WKT unexpected trailing input: " + std::string(rest));
         }
     }
 
@@ -155,13 +147,13 @@ GeoCsvParser::Geometry WktParser::parse()
 
 void WktParser::skipWhiteSpace()
 {
-    while (pos < wktString.size() && std::isspace(static_cast<unsigned char>(wktString[pos])))
+    while (pos < wktString.size() && isSpace(wktString[pos]))
     {
         ++pos;
     }
 }
 
-std::string WktParser::readWord()
+std::string_view WktParser::readWord()
 {
     skipWhiteSpace();
     size_t start = pos;
@@ -176,9 +168,7 @@ std::string WktParser::readWord()
         throw std::runtime_error("WKT expected type keyword");
     }
 
-    std::string w = wktString.substr(start, pos - start);
-
-    return toLower(w);
+    return wktString.substr(start, pos - start);
 }
 
 void WktParser::skipOptionalDimensionToken()
@@ -192,7 +182,7 @@ void WktParser::skipOptionalDimensionToken()
 
     if (std::isalpha(static_cast<unsigned char>(wktString[pos])))
     {
-        std::string tok = readWord();
+        const std::string tok = toLower(readWord());
         if (tok != "z" && tok != "m" && tok != "zm")
         {
             throw std::runtime_error("WKT unexpected token before coordinates: " + tok);
@@ -229,151 +219,185 @@ void WktParser::expect(char c)
     }
 }
 
-double WktParser::readNumber()
+// The syntax is checked here first so the accepted forms stay [+-]digits[.digits][(e|E)[+-]digits], no inf, nan or
+// hex. Then std::from_chars converts the range in place. On failure only leading whitespace is consumed
+bool WktParser::tryReadNumber(double& out)
 {
     skipWhiteSpace();
-    size_t start = pos;
+    const size_t start = pos;
+    size_t       end   = pos;
 
-    if (pos < wktString.size() && (wktString[pos] == '+' || wktString[pos] == '-'))
+    if (end < wktString.size() && (wktString[end] == '+' || wktString[end] == '-'))
     {
-        ++pos;
+        ++end;
     }
 
     bool hasDigit = false;
-    while (pos < wktString.size() && std::isdigit(static_cast<unsigned char>(wktString[pos])))
+    while (end < wktString.size() && isDigit(wktString[end]))
     {
         hasDigit = true;
-        ++pos;
+        ++end;
     }
 
-    if (pos < wktString.size() && wktString[pos] == '.')
+    if (end < wktString.size() && wktString[end] == '.')
     {
-        ++pos;
+        ++end;
 
-        while (pos < wktString.size() && std::isdigit(static_cast<unsigned char>(wktString[pos])))
+        while (end < wktString.size() && isDigit(wktString[end]))
         {
             hasDigit = true;
-            ++pos;
+            ++end;
         }
     }
 
-    if (pos < wktString.size() && (wktString[pos] == 'e' || wktString[pos] == 'E'))
+    if (end < wktString.size() && (wktString[end] == 'e' || wktString[end] == 'E'))
     {
-        ++pos;
+        ++end;
 
-        if (pos < wktString.size() && (wktString[pos] == '+' || wktString[pos] == '-'))
+        if (end < wktString.size() && (wktString[end] == '+' || wktString[end] == '-'))
         {
-            ++pos;
+            ++end;
         }
 
         bool expDigit = false;
-        while (pos < wktString.size() && std::isdigit(static_cast<unsigned char>(wktString[pos])))
+        while (end < wktString.size() && isDigit(wktString[end]))
         {
             expDigit = true;
-            ++pos;
+            ++end;
         }
 
         hasDigit = hasDigit && expDigit;
     }
 
     if (!hasDigit)
+    {
+        return false;
+    }
+
+    // std::from_chars does not accept a leading '+'
+    const char* first = wktString.data() + start + (wktString[start] == '+' ? 1 : 0);
+    const char* last  = wktString.data() + end;
+
+    const auto [ptr, ec] = std::from_chars(first, last, out);
+    if (ec != std::errc() || ptr != last)
+    {
+        return false;
+    }
+
+    pos = end;
+
+    return true;
+}
+
+double WktParser::readNumber()
+{
+    double value = 0.0;
+    if (!tryReadNumber(value))
     {
         throw std::runtime_error("WKT expected number");
     }
 
-    return std::stod(wktString.substr(start, pos - start));
+    return value;
 }
 
+// Z and M values are optional and skipped
 GeoCsvParser::Point WktParser::readPoint()
 {
-    double x    = readNumber();
-    double y    = readNumber();
-    size_t save = pos;
+    double x = readNumber();
+    double y = readNumber();
 
-    try
-    {
-        readNumber();
-        save = pos;
-        try
-        {
-            readNumber();
-        } catch (...)
-        {
-            pos = save;
-        }
-    } catch (...)
+    double ignored = 0.0;
+    if (tryReadNumber(ignored))
     {
-        pos = save;
+        tryReadNumber(ignored);
     }
 
     return {x, y};
 }
 
-std::vector<GeoCsvParser::Point> WktParser::readPointList()
+// Appends the points to the store and closes a ring after them. Room for them is made up front from the commas before
+// the closing parenthesis
+void WktParser::readRing()
 {
-    std::vector<GeoCsvParser::Point> pts;
     expect('(');
-    pts.push_back(readPoint());
+
+    auto& points = store->points;
+
+    // The store is shared by the whole file, so it still grows geometrically instead of to the exact size
+    const size_t close = wktString.find(')', pos);
+    if (close != std::string_view::npos)
+    {
+        const auto   commas = std::count(wktString.begin() + pos, wktString.begin() + close, ',');
+        const size_t needed = points.size() + static_cast<size_t>(commas) + 1;
+
+        if (needed > points.capacity())
+        {
+            points.reserve(std::max(needed, points.capacity() * 2));
+        }
+    }
+
+    points.push_back(readPoint());
 
     while (consume(','))
     {
-        pts.push_back(readPoint());
+        points.push_back(readPoint());
     }
 
     expect(')');
 
-    return pts;
+    if (points.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw std::runtime_error("WKT too many points for the geometry store");
+    }
+
+    store->ringStarts.push_back(static_cast<uint32_t>(points.size()));
 }
 
-GeoCsvParser::LineString WktParser::readLineString()
+// A part with a single ring
+void WktParser::readLineString()
 {
-    GeoCsvParser::LineString ls;
-
-    auto pts  = readPointList();
-    ls.points = std::move(pts);
-
-    return ls;
+    readRing();
+    store->partStarts.push_back(store->getRingCount());
 }
 
-GeoCsvParser::Polygon WktParser::readPolygon()
+// A part with the outer ring followed by the holes
+void WktParser::readPolygon()
 {
-    GeoCsvParser::Polygon poly;
     expect('(');
 
     do
     {
-        auto ringPts = readPointList();
-        poly.rings.push_back(GeoCsvParser::LineString{std::move(ringPts)});
+        readRing();
     } while (consume(','));
 
     expect(')');
 
-    return poly;
+    store->partStarts.push_back(store->getRingCount());
 }
 
-GeoCsvParser::GeometryType WktParser::baseGeomType(const std::string& lowerType)
+GeoCsvParser::GeometryType WktParser::baseGeomType(std::string_view type)
 {
-    if (lowerType.rfind("point", 0) == 0)
+    if (startsWithKeyword(type, "point"))
     {
         return GeoCsvParser::GeometryType::Point;
     }
 
-    if (lowerType.rfind("linestring", 0) == 0)
+    if (startsWithKeyword(type, "linestring"))
     {
         return GeoCsvParser::GeometryType::LineString;
     }
 
-    if (lowerType.rfind("multilinestring", 0) == 0)
+    if (startsWithKeyword(type, "multilinestring"))
     {
         return GeoCsvParser::GeometryType::MultiLineString;
     }
 
-    if (lowerType.rfind("polygon", 0) == 0)
+    if (startsWithKeyword(type, "polygon"))
     {
         return GeoCsvParser::GeometryType::Polygon;
     }
 
-    if (lowerType.rfind("multipolygon", 0) == 0)
+    if (startsWithKeyword(type, "multipolygon"))
     {
         return GeoCsvParser::GeometryType::MultiPolygon;
     }
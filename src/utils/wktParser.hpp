@@ -2,31 +2,36 @@
 #define WKT_PARSER_HPP
 
 #include <string>
+#include <string_view>
 
 #include "geoCsvParser.hpp"
 
+// Parses one WKT geometry in place, the text is not copied so it must outlive the parser.
+// Coordinates are appended to the store passed to parse(), the returned geometry refers to them by part range
 class WktParser
 {
 public:
-    WktParser(std::string src);
-    GeoCsvParser::Geometry parse();
+    WktParser(std::string_view src);
+    GeoCsvParser::Geometry parse(GeoCsvParser::GeometryStore& store);
 
 private:
-    std::string wktString;
-    size_t      pos = 0;
+    std::string_view             wktString;
+    size_t                       pos   = 0;
+    GeoCsvParser::GeometryStore* store = nullptr;
 
-    void        skipWhiteSpace();
-    std::string readWord();
-    void        skipOptionalDimensionToken();
-    bool        consume(char c);
-    void        expect(char c);
-    double      readNumber();
+    void             skipWhiteSpace();
+    std::string_view readWord();
+    void             skipOptionalDimensionToken();
+    bool             consume(char c);
+    void             expect(char c);
+    bool             tryReadNumber(double& out);
+    double           readNumber();
 
-    GeoCsvParser::Point              readPoint();
-    std::vector<GeoCsvParser::Point> readPointList();
-    GeoCsvParser::LineString         readLineString();
-    GeoCsvParser::Polygon            readPolygon();
-    GeoCsvParser::GeometryType       baseGeomType(const std::string& lowerType);
+    GeoCsvParser::Point        readPoint();
+    void                       readRing();
+    void                       readLineString();
+    void                       readPolygon();
+    GeoCsvParser::GeometryType baseGeomType(std::string_view type);
 };
 
 #endif
@@ -64,10 +64,10 @@ _terrain_data = (
 
 def convertAndPrintColormap(name, data, num_samples=256):
     """
-    Converts a Matplotlib colormap definition into a GLSL vec3 array.
+    Converts a Matplotlib colormap definition into a C++ stop list for src/colormaps.cpp.
     Handles both dictionary and list of tuples formats.
     """
-    print(f"const vec3 {name.upper()}_COLORS[{num_samples}] = vec3[](")
+    print(f"static const std::vector<Colormaps::Color> {name.upper()} = {{")
 
     # Create the colormap object from the data
     if isinstance(data, dict):
@@ -81,21 +81,16 @@ def convertAndPrintColormap(name, data, num_samples=256):
     sample_points = np.linspace(0, 1, num_samples)
     colors = cmap(sample_points)
 
-    glsl_lines = []
+    cpp_lines = []
 
     for i, color in enumerate(colors):
         # color is an (r, g, b, a) tuple but we only need RGB.
         r, g, b, a = color
-        line = f"    vec3({r:.6f}, {g:.6f}, {b:.6f})"
-
-        if i < num_samples - 1:
-            line += ","
-
-        glsl_lines.append(line)
+        cpp_lines.append(f"    {{{r:.6f}f, {g:.6f}f, {b:.6f}f}},")
 
     # Formatted output
-    print("\n".join(glsl_lines))
-    print(");")
+    print("\n".join(cpp_lines))
+    print("};")
     print("\n" * 2)
 
 NUM_SAMPLES: Final = 256